@@ -6,13 +6,68 @@
 
 #include "artery/envmod/BaseEnvironmentModelObject.h"
 #include <omnetpp/cexception.h>
+#include <cmath>
 
 namespace artery
 {
 
+namespace {
+
+// corner points of 1x1 square (heading east, front bumper at origin)
+const std::array<Position, 4> squareOutline = {{
+    Position(0.0, 0.5), // front left
+    Position(0.0, -0.5), // front right
+    Position(-1.0, -0.5), // back right
+    Position(-1.0, 0.5) // back left
+}};
+
+// attachment points for sensor
+const std::array<Position, 4> squareAttachmentPoints = {{
+    Position(0.0, 0.0), // front middle
+    Position(-0.5, -0.5), // right middle
+    Position(-1.0, 0.0), // back middle
+    Position(-0.5, 0.5) // left middle
+}};
+
+const Position squareCentrePoint(-0.5, 0.0);
+
+/**
+ * Affine transformation from unit square to world coordinates,
+ * i.e. scaling to vehicle dimensions, rotation into driving direction
+ * and translation to front bumper position combined in a single matrix.
+ */
+class ObjectTransform
+{
+public:
+    ObjectTransform(double length, double width, const Position& pos, Angle alpha)
+    {
+        // same (clockwise) rotation as boost::geometry's rotate_transformer
+        const double c = std::cos(alpha.radian());
+        const double s = std::sin(alpha.radian());
+        m_xx = c * length;
+        m_xy = s * width;
+        m_yx = -s * length;
+        m_yy = c * width;
+        m_tx = pos.x.value();
+        m_ty = pos.y.value();
+    }
+
+    Position operator()(const Position& p) const
+    {
+        const double x = p.x.value();
+        const double y = p.y.value();
+        return Position { m_tx + m_xx * x + m_xy * y, m_ty + m_yx * x + m_yy * y };
+    }
+
+private:
+    double m_xx, m_xy, m_yx, m_yy;
+    double m_tx, m_ty;
+};
+
+}
+
 const Position& BaseEnvironmentModelObject::getAttachmentPoint(const SensorPosition& pos) const
 {
-    assert(mAttachmentPoints.size() == 4);
     const Position* point = nullptr;
     switch (pos) {
         case SensorPosition::FRONT:
@@ -35,4 +90,19 @@ const Position& BaseEnvironmentModelObject::getAttachmentPoint(const SensorPosit
     return *point;
 }
 
+void BaseEnvironmentModelObject::placeRectangle(const Position& front, Angle heading)
+{
+    // geometry is recalculated in place, i.e. only the first call allocates the outline
+    const ObjectTransform affine { mLength.value(), mWidth.value(), front, heading };
+    mOutline.resize(squareOutline.size());
+
+    mCentrePoint = affine(squareCentrePoint);
+    for (std::size_t i = 0; i < squareOutline.size(); ++i) {
+        mOutline[i] = affine(squareOutline[i]);
+    }
+    for (std::size_t i = 0; i < squareAttachmentPoints.size(); ++i) {
+        mAttachmentPoints[i] = affine(squareAttachmentPoints[i]);
+    }
+}
+
 } // namespace artery
@@ -8,6 +8,7 @@
 #define BASEENVIRONMENTMODELOBJECT_H_
 
 #include "artery/envmod/EnvironmentModelObject.h"
+#include <array>
 
 namespace artery
 {
@@ -25,13 +26,24 @@ public:
     Length getLength() const override { return mLength; }
     Length getWidth() const override { return mWidth; }
     Length getRadius() const override { return mRadius; }
+    ObjectHandle getHandle() const override { return mHandle; }
 
 protected:
+    /**
+     * Place rectangular outline, attachment points and centre point of this object
+     *
+     * The rectangle's size is given by mLength and mWidth.
+     * @param front position of front bumper centre
+     * @param heading clockwise rotation of an object heading east
+     */
+    void placeRectangle(const Position& front, Angle heading);
+
+    ObjectHandle mHandle = NoObjectHandle;
     Length mLength;
     Length mWidth;
     Length mRadius;
     std::vector<Position> mOutline;
-    std::vector<Position> mAttachmentPoints;
+    std::array<Position, 4> mAttachmentPoints; /*< front, right, back, left */
     Position mCentrePoint;
 };
 
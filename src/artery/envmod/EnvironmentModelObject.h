@@ -11,12 +11,23 @@
 #include "artery/utility/Geometry.h"
 #include <vanetza/units/length.hpp>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace artery
 {
 
+/**
+ * Dense integer handle of an object tracked by the GlobalEnvironmentModel.
+ *
+ * A handle refers to the same object as long as this object exists.
+ * Handles of removed objects are recycled for objects added later on.
+ */
+using ObjectHandle = std::uint32_t;
+constexpr ObjectHandle NoObjectHandle = std::numeric_limits<ObjectHandle>::max();
+
 /**
  * EnvironmentModelObject is the interface class for all dynamic objects
  * tracked by the GlobalEnvironmentModel and thus detectable by sensors.
@@ -33,12 +44,27 @@ public:
      */
     virtual void update() = 0;
 
+    /**
+     * Track the object's position without updating any other object data.
+     *
+     * Used for lazy updates of objects out of any sensor's reach, thus it should be cheap.
+     * The object is guaranteed to lie completely within 2 * getRadius() around the tracked position.
+     * @return current reference position of object
+     */
+    virtual Position trackPosition() { update(); return getCentrePoint(); }
+
     /**
      * Returns the external ID of the object.
      * In most cases this is the SUMO identifier.
      * @return external ID
      */
-    virtual std::string getExternalId() const = 0;
+    virtual const std::string& getExternalId() const = 0;
+
+    /**
+     * Returns the handle assigned to this object by the GlobalEnvironmentModel
+     * @return object handle
+     */
+    virtual ObjectHandle getHandle() const = 0;
 
     /**
      * Returns the polygon describing the object's outline
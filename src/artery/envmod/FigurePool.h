@@ -0,0 +1,112 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_FIGUREPOOL_H_Q6ZC3NRA
+#define ENVMOD_FIGUREPOOL_H_Q6ZC3NRA
+
+#include "artery/utility/Geometry.h"
+#include <omnetpp/ccanvas.h>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * FigurePool recycles the child figures of a group figure across display refreshes.
+ *
+ * Figures are acquired one by one for each refresh, figures not acquired during a refresh
+ * are hidden instead of being deleted. All figures remain owned by the group figure.
+ */
+template<typename FIGURE>
+class FigurePool
+{
+public:
+    using Setup = std::function<void(FIGURE*)>;
+
+    /**
+     * Assign pool to a group figure
+     * @param group parent of all pooled figures
+     * @param setup invoked once for each newly created figure, e.g. to set colors
+     */
+    void assign(omnetpp::cGroupFigure* group, Setup setup = nullptr)
+    {
+        mGroup = group;
+        mSetup = std::move(setup);
+        mFigures.clear();
+        mUsed = 0;
+    }
+
+    /**
+     * Begin a refresh, i.e. all figures become available for acquisition again
+     */
+    void begin() { mUsed = 0; }
+
+    /**
+     * Acquire a (visible) figure for the current refresh
+     * @return recycled or newly created figure
+     */
+    FIGURE* acquire()
+    {
+        FIGURE* figure = nullptr;
+        if (mUsed < mFigures.size()) {
+            figure = mFigures[mUsed];
+            figure->setVisible(true);
+        } else {
+            figure = new FIGURE();
+            if (mSetup) {
+                mSetup(figure);
+            }
+            mGroup->addFigure(figure);
+            mFigures.push_back(figure);
+        }
+        ++mUsed;
+        return figure;
+    }
+
+    /**
+     * End a refresh, i.e. hide all figures not acquired since begin()
+     */
+    void end()
+    {
+        for (std::size_t i = mUsed; i < mFigures.size(); ++i) {
+            mFigures[i]->setVisible(false);
+        }
+    }
+
+private:
+    omnetpp::cGroupFigure* mGroup = nullptr;
+    Setup mSetup;
+    std::vector<FIGURE*> mFigures;
+    std::size_t mUsed = 0;
+};
+
+/**
+ * Set points of polygon figure, existing points are overwritten in place if possible
+ * @param polygon figure
+ * @param outline new points
+ */
+inline void setFigurePoints(omnetpp::cPolygonFigure* polygon, const std::vector<Position>& outline)
+{
+    using omnetpp::cFigure;
+    if (polygon->getNumPoints() == static_cast<int>(outline.size())) {
+        for (std::size_t i = 0; i < outline.size(); ++i) {
+            polygon->setPoint(static_cast<int>(i), cFigure::Point { outline[i].x.value(), outline[i].y.value() });
+        }
+    } else {
+        std::vector<cFigure::Point> points;
+        points.reserve(outline.size());
+        for (const Position& pos : outline) {
+            points.push_back(cFigure::Point { pos.x.value(), pos.y.value() });
+        }
+        polygon->setPoints(points);
+    }
+}
+
+} // namespace artery
+
+#endif /* ENVMOD_FIGUREPOOL_H_Q6ZC3NRA */
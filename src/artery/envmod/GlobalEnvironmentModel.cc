@@ -6,14 +6,19 @@
 
 #include "artery/envmod/GlobalEnvironmentModel.h"
 #include "artery/envmod/Geometry.h"
+#include "artery/envmod/LocalEnvironmentModel.h"
 #include "artery/envmod/TraCIEnvironmentModelObject.h"
+#include "artery/envmod/sensor/Sensor.h"
 #include "artery/envmod/sensor/SensorConfiguration.h"
 #include "artery/traci/Cast.h"
 #include "artery/traci/ControllableVehicle.h"
 #include "artery/traci/ControllablePerson.h"
+#include "artery/traci/PolygonDatabase.h"
 #include "artery/utility/IdentityRegistry.h"
+#include "artery/utility/WorkerPool.h"
 #include "traci/Core.h"
 #include <boost/geometry/geometries/register/linestring.hpp>
+#include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <inet/common/ModuleAccess.h>
 #include <algorithm>
@@ -35,21 +40,6 @@ const simsignal_t traciNodeAddSignal = cComponent::registerSignal("traci.node.ad
 const simsignal_t traciNodeRemoveSignal = cComponent::registerSignal("traci.node.remove");
 const simsignal_t traciNodeUpdateSignal = cComponent::registerSignal("traci.node.update");
 
-template<typename RT>
-typename RT::const_query_iterator
-query_intersections(RT& rtree, const std::vector<Position>& area)
-{
-#if BOOST_VERSION >= 106000 && BOOST_VERSION < 106200
-    // Boost versions 1.60 and 1.61 do not compile without copy
-    geometry::Polygon area_copy;
-    boost::geometry::convert(area, area_copy);
-    auto predicate = boost::geometry::index::intersects(area_copy);
-#else
-    auto predicate = boost::geometry::index::intersects(area);
-#endif
-    return rtree.qbegin(predicate);
-}
-
 } // namespace
 
 GlobalEnvironmentModel::GlobalEnvironmentModel()
@@ -63,50 +53,143 @@ GlobalEnvironmentModel::~GlobalEnvironmentModel()
 
 void GlobalEnvironmentModel::refresh()
 {
-    for (auto& object_kv : mObjects) {
-        object_kv.second->update();
+    ++mRefreshes;
+    for (auto& object : mObjects) {
+        if (!object) {
+            continue;
+        } else if (mLazyObjectUpdates) {
+            mObjectPositions[object->getHandle()] = object->trackPosition();
+        } else {
+            object->update();
+        }
     }
 
-    buildObjectRtree();
+    if (mObjectRtreeMargin > 0.0 && !mTainted) {
+        updateObjectRtree();
+    } else {
+        buildObjectRtree();
+    }
 
-    if (mDrawVehicles) {
-        int numObjects = mObjects.size();
-        int numFigures = mDrawVehicles->getNumFigures();
+    emit(refreshSignal, this);
+    measureDeferred();
+}
 
-        // add missing polygon figures
-        while (numFigures < numObjects) {
-            auto polygon = new cPolygonFigure();
-            polygon->setFillColor(cFigure::BLUE);
-            polygon->setFilled(true);
-            mDrawVehicles->addFigure(polygon);
-            ++numFigures;
+void GlobalEnvironmentModel::refreshDisplay() const
+{
+    // figures change only when objects have been refreshed or updated lazily since last drawing
+    if (!mDrawVehicles || (mDrawnRefreshes == mRefreshes && mDrawnLazyUpdates == mLazyUpdates)) {
+        return;
+    }
+
+    mVehicleFigures.begin();
+    for (const auto& object : mObjects) {
+        if (!object) {
+            continue;
+        } else if (mLazyObjectUpdates && mObjectUpdates[object->getHandle()] != mRefreshes) {
+            // outline is outdated but drawing must not update the object
+            continue;
         }
 
-        // remove excessive polygon figures
-        while (numFigures > numObjects) {
-            --numFigures;
-            delete mDrawVehicles->removeFigure(numFigures);
+        setFigurePoints(mVehicleFigures.acquire(), object->getOutline());
+    }
+    mVehicleFigures.end();
+    mDrawnRefreshes = mRefreshes;
+    mDrawnLazyUpdates = mLazyUpdates;
+}
+
+void GlobalEnvironmentModel::updateLazily(ObjectHandle handle) const
+{
+    if (mLazyObjectUpdates && mObjectUpdates[handle] != mRefreshes) {
+        mObjects[handle]->update();
+        mObjectUpdates[handle] = mRefreshes;
+        ++mLazyUpdates;
+    }
+}
+
+void GlobalEnvironmentModel::prepareMeasurement(const Sensor& sensor)
+{
+    geometry::Box area;
+    if (mLazyObjectUpdates && sensor.getPreselectionArea(area)) {
+        // object rtree covers the reach of all objects, i.e. no object in area is missed
+        ASSERT(!mTainted);
+        auto it = mObjectRtree.qbegin(boost::geometry::index::intersects(area));
+        for (; it != mObjectRtree.qend(); ++it) {
+            updateLazily(it->second);
         }
+    }
+}
+
+bool GlobalEnvironmentModel::deferMeasurement(LocalEnvironmentModel* local)
+{
+    if (mWorkerPool) {
+        mDeferredMeasurements.push_back(local);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+void GlobalEnvironmentModel::measureDeferred()
+{
+    struct Measurement
+    {
+        Sensor* sensor;
+        bool deferred;
+        SensorDetection detection;
+    };
 
-        // update figures with current outlines
-        int figureIndex = 0;
-        for (const auto& object_kv : mObjects) {
-            // we add only polygon figures, thus static_cast should be safe
-            auto polygon = static_cast<cPolygonFigure*>(mDrawVehicles->getFigure(figureIndex));
-            std::vector<cFigure::Point> points;
-            for (const Position& pos : object_kv.second->getOutline()) {
-                points.push_back(cFigure::Point { pos.x.value(), pos.y.value() });
+    if (mDeferredMeasurements.empty()) {
+        return;
+    }
+
+    // dispatch only to sensors being due
+    const SimTime now = simTime();
+    std::vector<Measurement> measurements;
+    std::vector<std::size_t> deferred; /*< indices of deferred measurements */
+    std::vector<std::size_t> localEnds; /*< measurements of i-th local model end before localEnds[i] */
+    for (LocalEnvironmentModel* local : mDeferredMeasurements) {
+        for (Sensor* sensor : local->getSensors()) {
+            if (sensor->isMeasurementDue(now)) {
+                prepareMeasurement(*sensor);
+                const bool deferrable = sensor->hasDeferrableMeasurement();
+                if (deferrable) {
+                    deferred.push_back(measurements.size());
+                }
+                measurements.push_back(Measurement { sensor, deferrable, SensorDetection {} });
             }
-            polygon->setPoints(points);
-            ++figureIndex;
         }
+        localEnds.push_back(measurements.size());
     }
 
-    emit(refreshSignal, this);
+    // detection phase: global model is read-only, no OMNeT++ context switches
+    mWorkerPool->run(deferred.size(), [&measurements, &deferred](std::size_t i) {
+        Measurement& measurement = measurements[deferred[i]];
+        measurement.detection = measurement.sensor->detectObjects();
+    });
+
+    // application phase: deterministic order as in serial mode
+    std::size_t measurement = 0;
+    for (std::size_t i = 0; i < mDeferredMeasurements.size(); ++i) {
+        for (; measurement < localEnds[i]; ++measurement) {
+            Measurement& current = measurements[measurement];
+            if (current.deferred) {
+                current.sensor->applyDetection(std::move(current.detection));
+            } else {
+                current.sensor->measurement();
+            }
+        }
+        mDeferredMeasurements[i]->update();
+    }
+
+    mDeferredMeasurements.clear();
 }
 
 bool GlobalEnvironmentModel::addObject(traci::Controller* controller)
 {
+    if (mObjectHandles.find(controller->getId()) != mObjectHandles.end()) {
+        return false;
+    }
+
     uint32_t id = 0;
     if (mIdentityRegistry) {
         auto identity = mIdentityRegistry->lookup<IdentityRegistry::traci>(controller->getId());
@@ -115,24 +198,51 @@ bool GlobalEnvironmentModel::addObject(traci::Controller* controller)
         }
     }
 
-    auto object = std::make_shared<TraCIEnvironmentModelObject>(controller, id);
-    auto insertion = mObjects.emplace(object->getExternalId(), object);
-    if (insertion.second) {
-        auto box = boost::geometry::return_envelope<geometry::Box>(object->getOutline());
-        mObjectRtree.insert(ObjectRtreeValue { std::move(box), object });
+    // recycle handles of removed objects to keep the object database dense
+    ObjectHandle handle = mObjects.size();
+    if (mFreeObjectHandles.empty()) {
+        mObjects.emplace_back();
+        mObjectBoxes.resize(mObjects.size());
+        if (mLazyObjectUpdates) {
+            mObjectUpdates.resize(mObjects.size());
+            mObjectPositions.resize(mObjects.size());
+        }
+        if (mObjectGenerations.size() < mObjects.size()) {
+            mObjectGenerations.resize(mObjects.size(), 0);
+        }
+    } else {
+        handle = mFreeObjectHandles.back();
+        mFreeObjectHandles.pop_back();
+    }
+
+    auto object = std::make_shared<TraCIEnvironmentModelObject>(controller, id, handle);
+    mObjectHandles.emplace(object->getExternalId(), handle);
+    mObjects[handle] = object;
+    if (mLazyObjectUpdates) {
+        // object has been updated completely by its constructor
+        mObjectUpdates[handle] = mRefreshes;
+        mObjectPositions[handle] = object->trackPosition();
     }
-    ASSERT(mObjects.size() == mObjectRtree.size());
-    return insertion.second;
+
+    auto box = getObjectEnvelope(*object);
+    if (mObjectRtreeMargin > 0.0) {
+        mObjectBoxes[handle] = box;
+    }
+    mObjectRtree.insert(ObjectRtreeValue { std::move(box), handle });
+    ASSERT(mTainted || mObjectHandles.size() == mObjectRtree.size());
+    return true;
 }
 
-bool GlobalEnvironmentModel::addObstacle(const std::string& id, std::vector<Position> outline)
+bool GlobalEnvironmentModel::addObstacle(const std::string& id, std::vector<Position> outline, bool validate)
 {
-    boost::geometry::correct(outline);
     std::string invalid;
-    if (!boost::geometry::is_valid(outline, invalid)) {
-        // skip self-intersecting geometry
-        EV_ERROR << "skip invalid obstacle polygon " << id << ": " << invalid << " \n";
-        return false;
+    if (validate) {
+        boost::geometry::correct(outline);
+        if (!boost::geometry::is_valid(outline, invalid)) {
+            // skip self-intersecting geometry
+            EV_ERROR << "skip invalid obstacle polygon " << id << ": " << invalid << " \n";
+            return false;
+        }
     }
     auto insertion = mObstacles.emplace(id, std::make_shared<EnvironmentModelObstacle>(id, outline));
 
@@ -170,37 +280,145 @@ void GlobalEnvironmentModel::buildObjectRtree()
 {
     struct envelope_maker
     {
-        inline ObjectRtreeValue operator()(const ObjectDB::value_type& obj_kv) const
+        const GlobalEnvironmentModel* model;
+
+        inline ObjectRtreeValue operator()(const ObjectDB::value_type& obj) const
+        {
+            return ObjectRtreeValue { model->getObjectEnvelope(*obj), obj->getHandle() };
+        }
+    };
+
+    struct exists
+    {
+        inline bool operator()(const ObjectDB::value_type& obj) const
         {
-            const std::shared_ptr<EnvironmentModelObject>& obj = obj_kv.second;
-            auto box = boost::geometry::return_envelope<geometry::Box>(obj->getOutline());
-            return ObjectRtreeValue { std::move(box), obj };
+            return static_cast<bool>(obj);
         }
     };
 
     // use bulk loading for efficient packing
-    mObjectRtree = ObjectRtree { mObjects | boost::adaptors::transformed(envelope_maker()) };
+    mObjectRtree = ObjectRtree { mObjects | boost::adaptors::filtered(exists()) |
+        boost::adaptors::transformed(envelope_maker { this }) };
     mTainted = false;
+    ++mObjectRtreeRebuilds;
+
+    if (mObjectRtreeMargin > 0.0) {
+        for (const ObjectRtreeValue& value : mObjectRtree) {
+            mObjectBoxes[value.second] = value.first;
+        }
+    }
+}
+
+void GlobalEnvironmentModel::updateObjectRtree()
+{
+    std::vector<ObjectRtreeValue> escaped;
+    for (const auto& object : mObjects) {
+        if (!object) {
+            continue;
+        }
+
+        const auto box = getObjectBox(*object);
+        const geometry::Box& loose = mObjectBoxes[object->getHandle()];
+        if (!boost::geometry::covered_by(box, loose)) {
+            escaped.emplace_back(loose, object->getHandle());
+        }
+    }
+
+    // re-inserting most objects one by one is more expensive than bulk loading
+    if (2 * escaped.size() > mObjectHandles.size()) {
+        buildObjectRtree();
+        return;
+    }
+
+    for (ObjectRtreeValue& value : escaped) {
+        mObjectRtree.remove(value);
+        value.first = getObjectEnvelope(*mObjects[value.second]);
+        mObjectBoxes[value.second] = value.first;
+        mObjectRtree.insert(value);
+    }
+
+    ++mObjectRtreeUpdates;
+    mObjectRtreeReinsertions += escaped.size();
+    ASSERT(mObjectHandles.size() == mObjectRtree.size());
+}
+
+geometry::Box GlobalEnvironmentModel::getObjectBox(const EnvironmentModelObject& object) const
+{
+    if (mLazyObjectUpdates) {
+        const Position& pos = mObjectPositions[object.getHandle()];
+        const double reach = 2.0 * object.getRadius().value();
+        return geometry::Box {
+            geometry::Point { pos.x.value() - reach, pos.y.value() - reach },
+            geometry::Point { pos.x.value() + reach, pos.y.value() + reach }
+        };
+    } else {
+        return boost::geometry::return_envelope<geometry::Box>(object.getOutline());
+    }
+}
+
+geometry::Box GlobalEnvironmentModel::getObjectEnvelope(const EnvironmentModelObject& object) const
+{
+    namespace bg = boost::geometry;
+    auto box = getObjectBox(object);
+    if (mObjectRtreeMargin > 0.0) {
+        bg::set<bg::min_corner, 0>(box, bg::get<bg::min_corner, 0>(box) - mObjectRtreeMargin);
+        bg::set<bg::min_corner, 1>(box, bg::get<bg::min_corner, 1>(box) - mObjectRtreeMargin);
+        bg::set<bg::max_corner, 0>(box, bg::get<bg::max_corner, 0>(box) + mObjectRtreeMargin);
+        bg::set<bg::max_corner, 1>(box, bg::get<bg::max_corner, 1>(box) + mObjectRtreeMargin);
+    }
+    return box;
 }
 
 bool GlobalEnvironmentModel::removeObject(const std::string& objectId)
 {
-    bool erased = mObjects.erase(objectId) > 0;
-    mTainted |= erased; /*< pending object rtree update */
-    return erased;
+    auto found = mObjectHandles.find(objectId);
+    if (found == mObjectHandles.end()) {
+        return false;
+    }
+
+    removeObject(found->second);
+    mObjectHandles.erase(found);
+    return true;
+}
+
+void GlobalEnvironmentModel::removeObject(ObjectHandle handle)
+{
+    ASSERT(handle < mObjects.size() && mObjects[handle]);
+    if (mObjectRtreeMargin > 0.0 && !mTainted) {
+        mObjectRtree.remove(ObjectRtreeValue { mObjectBoxes[handle], handle });
+    } else {
+        mTainted = true; /*< pending object rtree update */
+    }
+
+    mObjects[handle].reset();
+    mFreeObjectHandles.push_back(handle);
+    ++mObjectGenerations[handle];
 }
 
 void GlobalEnvironmentModel::removeObjects()
 {
+    // handles restart from zero, thus outdate all handles in use
+    for (ObjectHandle handle = 0; handle < mObjects.size(); ++handle) {
+        if (mObjects[handle]) {
+            ++mObjectGenerations[handle];
+        }
+    }
+
     mObjects.clear();
+    mObjectHandles.clear();
+    mFreeObjectHandles.clear();
     mObjectRtree.clear();
+    mObjectBoxes.clear();
+    mObjectUpdates.clear();
+    mObjectPositions.clear();
     mTainted = false;
 
     if (mDrawVehicles) {
-        // remove all polygons
-        for (int i = mDrawVehicles->getNumFigures() - 1; i >= 0; --i) {
-            delete mDrawVehicles->removeFigure(i);
-        }
+        // hide all polygons but keep them for reuse
+        mVehicleFigures.begin();
+        mVehicleFigures.end();
+        mDrawnRefreshes = mRefreshes;
+        mDrawnLazyUpdates = mLazyUpdates;
     }
 }
 
@@ -226,7 +444,12 @@ void GlobalEnvironmentModel::initialize()
     }
 
     mIdentityRegistry = inet::findModuleFromPar<IdentityRegistry>(par("identityRegistryModule"), this);
+    const std::string polygonDatabaseModule = par("polygonDatabaseModule").stdstringValue();
+    mPolygonDatabase = polygonDatabaseModule.empty() ? nullptr :
+        inet::getModuleFromPar<PolygonDatabase>(par("polygonDatabaseModule"), this);
     mTainted = false;
+    mObjectRtreeMargin = par("objectRtreeMargin");
+    mLazyObjectUpdates = par("lazyObjectUpdates");
 
     if (par("drawObstacles")) {
         mDrawObstacles = new omnetpp::cGroupFigure("obstacles");
@@ -236,14 +459,33 @@ void GlobalEnvironmentModel::initialize()
     if (par("drawVehicles")) {
         mDrawVehicles = new omnetpp::cGroupFigure("vehicles");
         getCanvas()->addFigure(mDrawVehicles);
+        mVehicleFigures.assign(mDrawVehicles, [](cPolygonFigure* polygon) {
+            polygon->setFillColor(cFigure::BLUE);
+            polygon->setFilled(true);
+        });
     }
 
     std::string obstacleTypes = par("obstacleTypes");
     boost::split(mObstacleTypes, obstacleTypes, boost::is_any_of(" "));
+
+    int measurementThreads = par("measurementThreads");
+    if (measurementThreads < 0) {
+        throw cRuntimeError("measurementThreads must not be negative");
+    } else if (measurementThreads != 1) {
+        mWorkerPool.reset(new WorkerPool(measurementThreads));
+        EV_INFO << "sensor measurements run on " << mWorkerPool->size() << " threads\n";
+    }
 }
 
 void GlobalEnvironmentModel::finish()
 {
+    mWorkerPool.reset();
+    recordScalar("objectRtreeRebuilds", mObjectRtreeRebuilds);
+    recordScalar("objectRtreeUpdates", mObjectRtreeUpdates);
+    recordScalar("objectRtreeReinsertions", mObjectRtreeReinsertions);
+    if (mLazyObjectUpdates) {
+        recordScalar("lazyObjectUpdates", mLazyUpdates);
+    }
     removeObjects();
 }
 
@@ -251,7 +493,12 @@ void GlobalEnvironmentModel::receiveSignal(cComponent* source, simsignal_t signa
 {
     if (signal == traciInitSignal) {
         auto core = check_and_cast<traci::Core*>(source);
-        fetchObstacles(*core->getAPI());
+        if (mPolygonDatabase) {
+            mPolygonDatabase->load(*core->getAPI());
+            fetchObstacles(*mPolygonDatabase);
+        } else {
+            fetchObstacles(*core->getAPI());
+        }
     } else if (signal == traciCloseSignal) {
         clear();
     }
@@ -307,6 +554,29 @@ void GlobalEnvironmentModel::fetchObstacles(const traci::API& traci)
     buildObstacleRtree();
 }
 
+void GlobalEnvironmentModel::fetchObstacles(const PolygonDatabase& db)
+{
+    for (const PolygonDatabase::Polygon& polygon : db.getPolygons()) {
+        if (!mObstacleTypes.empty()) {
+            if (mObstacleTypes.find(polygon.type) == mObstacleTypes.end()) {
+                // skip polygon because its type is not in our filter set
+                EV_DEBUG << "ignore polygon " << polygon.id << " of type " << polygon.type << "\n";
+                continue;
+            }
+        }
+
+        if (polygon.outline.size() < 3) {
+            EV_WARN << "skip obstacle polygon " << polygon.id << " because its shape is degraded\n";
+        } else if (!polygon.valid) {
+            EV_ERROR << "skip invalid obstacle polygon " << polygon.id << "\n";
+        } else {
+            addObstacle(polygon.id, polygon.outline, false);
+        }
+    }
+
+    buildObstacleRtree();
+}
+
 traci::Controller* GlobalEnvironmentModel::getController(cModule* module)
 {
     assert(module);
@@ -325,54 +595,68 @@ traci::Controller* GlobalEnvironmentModel::getController(cModule* module)
     return nullptr;
 }
 
-std::shared_ptr<EnvironmentModelObject> GlobalEnvironmentModel::getObject(const std::string& objId)
+std::shared_ptr<EnvironmentModelObject> GlobalEnvironmentModel::getObject(const std::string& objId) const
+{
+    return getObject(getObjectHandle(objId));
+}
+
+std::shared_ptr<EnvironmentModelObject> GlobalEnvironmentModel::getObject(ObjectHandle handle) const
 {
-    auto found = mObjects.find(objId);
-    return found != mObjects.end() ? found->second : nullptr;
+    if (handle < mObjects.size() && mObjects[handle]) {
+        updateLazily(handle);
+        return mObjects[handle];
+    } else {
+        return nullptr;
+    }
 }
 
-std::shared_ptr<EnvironmentModelObstacle> GlobalEnvironmentModel::getObstacle(const std::string& obsId)
+ObjectHandle GlobalEnvironmentModel::getObjectHandle(const std::string& objId) const
+{
+    auto found = mObjectHandles.find(objId);
+    return found != mObjectHandles.end() ? found->second : NoObjectHandle;
+}
+
+std::uint32_t GlobalEnvironmentModel::getObjectGeneration(ObjectHandle handle) const
+{
+    return handle < mObjectGenerations.size() ? mObjectGenerations[handle] : 0;
+}
+
+std::shared_ptr<EnvironmentModelObstacle> GlobalEnvironmentModel::getObstacle(const std::string& obsId) const
 {
     auto found = mObstacles.find(obsId);
     return found != mObstacles.end() ? found->second : nullptr;
 }
 
 std::vector<std::shared_ptr<EnvironmentModelObject>>
-GlobalEnvironmentModel::preselectObjects(const std::string& ego, const std::vector<Position>& area)
+GlobalEnvironmentModel::preselectObjects(const std::string& ego, const std::vector<Position>& area, bool checkArea) const
+{
+    return preselectObjects(getObjectHandle(ego), area, checkArea);
+}
+
+std::vector<std::shared_ptr<EnvironmentModelObject>>
+GlobalEnvironmentModel::preselectObjects(ObjectHandle ego, const std::vector<Position>& area, bool checkArea) const
 {
     ASSERT(!mTainted);
 
     boost::geometry::validity_failure_type failure;
-    if (!boost::geometry::is_valid(area, failure)) {
+    if (checkArea && !boost::geometry::is_valid(area, failure)) {
         std::string error_msg =  boost::geometry::validity_failure_type_message(failure);
         throw omnetpp::cRuntimeError("preselection polygon is invalid: %s", error_msg.c_str());
     }
 
-    std::vector<std::shared_ptr<EnvironmentModelObject>> objectsInSearchArea;
-    ObjectRtree::const_query_iterator it = query_intersections(mObjectRtree, area);
-    for (; it != mObjectRtree.qend(); ++it) {
-        if (it->second->getExternalId() != ego && it->second->isVisible()) {
-            objectsInSearchArea.push_back(it->second);
-        }
-    }
-    return objectsInSearchArea;
+    return artery::preselectObjects(mObjectRtree, mObjects, ego, area);
 }
 
 std::vector<std::shared_ptr<EnvironmentModelObstacle>>
-GlobalEnvironmentModel::preselectObstacles(const std::vector<Position>& area)
+GlobalEnvironmentModel::preselectObstacles(const std::vector<Position>& area, bool checkArea) const
 {
     boost::geometry::validity_failure_type failure;
-    if (!boost::geometry::is_valid(area, failure)) {
+    if (checkArea && !boost::geometry::is_valid(area, failure)) {
         std::string error_msg =  boost::geometry::validity_failure_type_message(failure);
         throw omnetpp::cRuntimeError("preselection polygon is invalid: %s", error_msg.c_str());
     }
 
-    std::vector<std::shared_ptr<EnvironmentModelObstacle>> obstacles;
-    ObstacleRtree::const_query_iterator it = query_intersections(mObstacleRtree, area);
-    for (; it != mObstacleRtree.qend(); ++it) {
-        obstacles.push_back(it->second);
-    }
-    return obstacles;
+    return artery::preselectObstacles(mObstacleRtree, area);
 }
 
 } // namespace artery
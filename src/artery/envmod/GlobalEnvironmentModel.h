@@ -8,9 +8,11 @@
 #define GLOBALENVIRONMENTMODEL_H_
 
 #include "artery/envmod/sensor/SensorDetection.h"
+#include "artery/envmod/FigurePool.h"
 #include "artery/envmod/Geometry.h"
 #include "artery/envmod/EnvironmentModelObject.h"
 #include "artery/envmod/EnvironmentModelObstacle.h"
+#include "artery/envmod/Preselection.h"
 #include "artery/utility/Geometry.h"
 #include <omnetpp/ccanvas.h>
 #include <omnetpp/clistener.h>
@@ -33,6 +35,10 @@ namespace artery
 
 class EnvironmentModelObstacle;
 class IdentityRegistry;
+class LocalEnvironmentModel;
+class PolygonDatabase;
+class Sensor;
+class WorkerPool;
 
 /**
  * The GlobalEnvironmentModel has the global view of all objects and obstacles
@@ -44,6 +50,8 @@ class IdentityRegistry;
  * 
  * Objects are dynamic and updated for each SUMO simulation step.
  * Such dynamic objects are vehicles and pedestrians.
+ * With lazy object updates, objects are only updated completely if they might be
+ * preselected by a sensor or are fetched explicitly. Otherwise, only their position is tracked.
  */
 class GlobalEnvironmentModel : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
@@ -54,6 +62,7 @@ public:
     // cSimpleModule life-cycle
     void initialize() override;
     void finish() override;
+    void refreshDisplay() const override;
 
     // cListener handlers
     void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, const omnetpp::SimTime&, omnetpp::cObject*) override;
@@ -65,38 +74,110 @@ public:
      * @param externalID
      * @return model object matching external id
      */
-    std::shared_ptr<EnvironmentModelObject> getObject(const std::string& objId);
+    std::shared_ptr<EnvironmentModelObject> getObject(const std::string& objId) const;
+
+    /**
+     * Fetch an object by its handle.
+     * @param handle object handle
+     * @return model object matching handle or nullptr
+     */
+    std::shared_ptr<EnvironmentModelObject> getObject(ObjectHandle handle) const;
+
+    /**
+     * Look up the handle of an object by its external id.
+     * @param objId external id, e.g. TraCI id
+     * @return object handle or NoObjectHandle if no such object exists
+     */
+    ObjectHandle getObjectHandle(const std::string& objId) const;
+
+    /**
+     * Get generation of an object handle.
+     *
+     * The generation changes whenever the object behind this handle is removed,
+     * i.e. a matching generation tells that a handle still refers to the same object.
+     * @param handle object handle
+     * @return generation counter
+     */
+    std::uint32_t getObjectGeneration(ObjectHandle handle) const;
 
     /**
      * Get an obstacle by its id
      * @param obsId obstacle id
      * @return obstacle model matching the id or nullptr
      */
-    std::shared_ptr<EnvironmentModelObstacle> getObstacle(const std::string& obsId);
+    std::shared_ptr<EnvironmentModelObstacle> getObstacle(const std::string& obsId) const;
 
     /**
      * Preselect all objects close to the given area
      * @param ego identifier of the ego object, which is filtered out of the result
      * @param area search polygon
+     * @param checkArea validate search polygon, can be skipped for pre-validated polygons
+     * @return preselected objects, i.e. candidates for precise sensor checks
+     */
+    std::vector<std::shared_ptr<EnvironmentModelObject>>
+    preselectObjects(const std::string& ego, const std::vector<Position>& area, bool checkArea = true) const;
+
+    /**
+     * Preselect all objects close to the given area
+     * @param ego handle of the ego object (or NoObjectHandle), which is filtered out of the result
+     * @param area search polygon
+     * @param checkArea validate search polygon, can be skipped for pre-validated polygons
      * @return preselected objects, i.e. candidates for precise sensor checks
      */
     std::vector<std::shared_ptr<EnvironmentModelObject>>
-    preselectObjects(const std::string& ego, const std::vector<Position>& area);
+    preselectObjects(ObjectHandle ego, const std::vector<Position>& area, bool checkArea = true) const;
 
     /**
      * Preselect all obstacles close to the given area
      * @param area search polygon
+     * @param checkArea validate search polygon, can be skipped for pre-validated polygons
      * @return preselected obstacles
      */
     std::vector<std::shared_ptr<EnvironmentModelObstacle>>
-    preselectObstacles(const std::vector<Position>& area);
+    preselectObstacles(const std::vector<Position>& area, bool checkArea = true) const;
+
+    /**
+     * Prepare a sensor measurement
+     *
+     * With lazy object updates, all objects the sensor may preselect are updated beforehand.
+     * Must be called before each measurement but not concurrently, i.e. not while detecting objects in parallel.
+     * @param sensor sensor about to measure
+     */
+    void prepareMeasurement(const Sensor& sensor);
+
+    /**
+     * Defer sensor measurements of a local environment model to the parallel measurement phase.
+     *
+     * Only meaningful while the EnvironmentModel.refresh signal is emitted.
+     * Deferred local models are measured in order of deferral after all listeners have been notified.
+     * @param local local environment model
+     * @return false if parallel measurements are disabled, i.e. caller has to measure immediately
+     */
+    bool deferMeasurement(LocalEnvironmentModel* local);
 
 private:
     /**
      * Refresh all dynamic objects in the database.
+     *
+     * With lazy object updates, only object positions are tracked here.
      */
     void refresh();
 
+    /**
+     * Update object unless it has been updated since last refresh
+     * @param handle handle of an existing object
+     */
+    void updateLazily(ObjectHandle handle) const;
+
+    /**
+     * Measure all deferred local environment models.
+     *
+     * Only sensors due for measurement are dispatched.
+     * Detections of deferrable sensors are computed in parallel while the model is read-only.
+     * Afterwards, detections are applied in order of deferral and sensor configuration.
+     */
+    void measureDeferred();
+
     /**
      * Add object to the environment database
      * @param vehicle TraCI mobility corresponding to vehicle
@@ -111,6 +192,12 @@ private:
      */
     bool removeObject(const std::string& id);
 
+    /**
+     * Remove object from the database
+     * @param handle handle of object to be removed
+     */
+    void removeObject(ObjectHandle handle);
+
     /**
      * Remove all known objects from internal database
      */
@@ -120,9 +207,10 @@ private:
      * Add (static) obstacles to the obstacle database
      * @param id Obstacle's id
      * @param outline Obstacle's outline
+     * @param validate correct and validate outline, can be skipped for pre-validated outlines
      * @return true if it could be added
      */
-    bool addObstacle(const std::string& id, std::vector<Position> outline);
+    bool addObstacle(const std::string& id, std::vector<Position> outline, bool validate = true);
 
     /**
      * Create the obstacle rtree.
@@ -135,6 +223,28 @@ private:
      */
     void buildObjectRtree();
 
+    /**
+     * Update the object rtree incrementally.
+     * Only objects leaving their enlarged bounding box are re-inserted.
+     */
+    void updateObjectRtree();
+
+    /**
+     * Compute bounding box of object
+     *
+     * With lazy object updates, the box covers the object's reach around its tracked position.
+     * @param object environment model object
+     * @return bounding box
+     */
+    geometry::Box getObjectBox(const EnvironmentModelObject& object) const;
+
+    /**
+     * Compute bounding box of object enlarged by object rtree margin
+     * @param object environment model object
+     * @return (loose) bounding box
+     */
+    geometry::Box getObjectEnvelope(const EnvironmentModelObject& object) const;
+
     /**
      * Clears the internal database completely
      */
@@ -146,6 +256,12 @@ private:
      */
     void fetchObstacles(const traci::API& api);
 
+    /**
+     * Pick static obstacles from polygon database
+     * @param db polygon database
+     */
+    void fetchObstacles(const PolygonDatabase& db);
+
     /**
      * Try to get controller corresponding to given module
      * @param mod host module
@@ -153,22 +269,39 @@ private:
      */
     virtual traci::Controller* getController(omnetpp::cModule* mod);
 
-    using ObjectDB = std::unordered_map<std::string, std::shared_ptr<EnvironmentModelObject>>;
-    using ObjectRtreeValue = std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObject>>;
-    using ObjectRtree = boost::geometry::index::rtree<ObjectRtreeValue, boost::geometry::index::quadratic<16>>;
+    using ObjectDB = std::vector<std::shared_ptr<EnvironmentModelObject>>; /*< indexed by handle, nullptr for unused handles */
+    using ObjectHandles = std::unordered_map<std::string, ObjectHandle>;
+    using ObjectBoxes = std::vector<geometry::Box>; /*< indexed by handle */
     using ObstacleDB = std::unordered_map<std::string, std::shared_ptr<EnvironmentModelObstacle>>;
-    using ObstacleRtreeValue = std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObstacle>>;
-    using ObstacleRtree = boost::geometry::index::rtree<ObstacleRtreeValue, boost::geometry::index::rstar<16>>;
 
     ObjectDB mObjects;
+    ObjectHandles mObjectHandles; /*< external ids of existing objects */
+    std::vector<ObjectHandle> mFreeObjectHandles;
+    std::vector<std::uint32_t> mObjectGenerations; /*< indexed by handle, never shrinks */
     ObjectRtree mObjectRtree;
+    ObjectBoxes mObjectBoxes; /*< boxes stored in object rtree (incremental mode only) */
+    double mObjectRtreeMargin = 0.0; /*< enlargement of object boxes, 0 disables incremental updates */
+    unsigned long mObjectRtreeRebuilds = 0;
+    unsigned long mObjectRtreeUpdates = 0;
+    unsigned long mObjectRtreeReinsertions = 0;
+    bool mLazyObjectUpdates = false;
+    unsigned long mRefreshes = 0;
+    mutable std::vector<unsigned long> mObjectUpdates; /*< indexed by handle, refresh of last full update (lazy mode only) */
+    std::vector<Position> mObjectPositions; /*< indexed by handle, tracked positions (lazy mode only) */
+    mutable unsigned long mLazyUpdates = 0;
     ObstacleDB mObstacles;
     ObstacleRtree mObstacleRtree;
     IdentityRegistry* mIdentityRegistry;
+    PolygonDatabase* mPolygonDatabase = nullptr;
     bool mTainted = false;
     omnetpp::cGroupFigure* mDrawObstacles = nullptr;
     omnetpp::cGroupFigure* mDrawVehicles = nullptr;
+    mutable FigurePool<omnetpp::cPolygonFigure> mVehicleFigures;
+    mutable unsigned long mDrawnRefreshes = 0;
+    mutable unsigned long mDrawnLazyUpdates = 0;
     std::set<std::string> mObstacleTypes;
+    std::unique_ptr<WorkerPool> mWorkerPool;
+    std::vector<LocalEnvironmentModel*> mDeferredMeasurements;
 };
 
 } // namespace artery
@@ -12,6 +12,7 @@
 #include "artery/utility/FilterRules.h"
 #include <inet/common/ModuleAccess.h>
 #include <omnetpp/cxmlelement.h>
+#include <algorithm>
 #include <utility>
 
 using namespace omnetpp;
@@ -52,45 +53,62 @@ void LocalEnvironmentModel::initialize(int stage)
 void LocalEnvironmentModel::finish()
 {
     mGlobalEnvironmentModel->unsubscribe(EnvironmentModelRefreshSignal, this);
-    mObjects.clear();
+    mTracker.clear();
 }
 
 void LocalEnvironmentModel::receiveSignal(cComponent*, simsignal_t signal, cObject* obj, cObject*)
 {
     if (signal == EnvironmentModelRefreshSignal) {
-        for (auto* sensor : mSensors) {
+        if (!mGlobalEnvironmentModel->deferMeasurement(this)) {
+            measurement();
+        }
+    }
+}
+
+void LocalEnvironmentModel::measurement()
+{
+    const SimTime now = simTime();
+    for (auto* sensor : mSensors) {
+        if (sensor->isMeasurementDue(now)) {
+            mGlobalEnvironmentModel->prepareMeasurement(*sensor);
             sensor->measurement();
         }
-        update();
     }
+    update();
 }
 
 void LocalEnvironmentModel::complementObjects(const SensorDetection& detection, const Sensor& sensor)
 {
-   for (auto& detectedObject : detection.objects) {
-      auto foundObject = mObjects.find(detectedObject);
-      if (foundObject != mObjects.end()) {
-         Tracking& tracking = foundObject->second;
-         tracking.tap(&sensor);
-      } else {
-         mObjects.emplace(detectedObject, Tracking { ++mTrackingCounter, &sensor });
-      }
-   }
+    const SimTime now = simTime();
+    const SimTime validity = sensor.getValidityPeriod();
+    for (auto& detectedObject : detection.objects) {
+        if (detectedObject) {
+            const std::uint32_t generation = mGlobalEnvironmentModel->getObjectGeneration(detectedObject->getHandle());
+            mTracker.tap(detectedObject, generation, &sensor, validity, now);
+        }
+    }
 }
 
 void LocalEnvironmentModel::update()
 {
-    for (auto it = mObjects.begin(); it != mObjects.end();) {
-        const Object& object = it->first;
-        Tracking& tracking = it->second;
-        tracking.update();
-
-        if (object.expired() || tracking.expired()) {
-            it = mObjects.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    mTracker.update(simTime(), [this](ObjectHandle handle) {
+        return mGlobalEnvironmentModel->getObjectGeneration(handle);
+    });
+}
+
+auto LocalEnvironmentModel::getTracking(ObjectHandle handle) const -> const Tracking*
+{
+    return mTracker.find(handle);
+}
+
+void LocalEnvironmentModel::addListener(Listener* listener)
+{
+    mTracker.addListener(listener);
+}
+
+void LocalEnvironmentModel::removeListener(Listener* listener)
+{
+    mTracker.removeListener(listener);
 }
 
 void LocalEnvironmentModel::initializeSensors()
@@ -133,54 +151,6 @@ void LocalEnvironmentModel::initializeSensors()
 }
 
 
-LocalEnvironmentModel::Tracking::Tracking(int id, const Sensor* sensor) : mId(id)
-{
-    mSensors.emplace(sensor, TrackingTime {});
-}
-
-bool LocalEnvironmentModel::Tracking::expired() const
-{
-    return mSensors.empty();
-}
-
-void LocalEnvironmentModel::Tracking::update()
-{
-    for (auto it = mSensors.begin(); it != mSensors.end();) {
-      const Sensor* sensor = it->first;
-      const TrackingTime& tracking = it->second;
-
-      const bool expired = tracking.last() + sensor->getValidityPeriod() < simTime();
-      if (expired) {
-          it = mSensors.erase(it);
-      } else {
-          ++it;
-      }
-    }
-}
-
-void LocalEnvironmentModel::Tracking::tap(const Sensor* sensor)
-{
-    auto found = mSensors.find(sensor);
-    if (found != mSensors.end()) {
-         TrackingTime& tracking = found->second;
-         tracking.tap();
-    } else {
-         mSensors.emplace(sensor, TrackingTime {});
-    }
-}
-
-
-LocalEnvironmentModel::TrackingTime::TrackingTime() :
-   mFirst(simTime()), mLast(simTime())
-{
-}
-
-void LocalEnvironmentModel::TrackingTime::tap()
-{
-    mLast = simTime();
-}
-
-
 TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel::TrackedObjects& all, const std::string& category)
 {
     // capture `category` by value because lambda expression will be evaluated after this function's return
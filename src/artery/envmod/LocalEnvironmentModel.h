@@ -7,20 +7,18 @@
 #ifndef LOCALENVIRONMENTMODEL_H_
 #define LOCALENVIRONMENTMODEL_H_
 
+#include "artery/envmod/ObjectTracker.h"
 #include <boost/iterator/filter_iterator.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <omnetpp/clistener.h>
 #include <omnetpp/csimplemodule.h>
-#include <omnetpp/simtime.h>
 #include <functional>
-#include <map>
-#include <memory>
+#include <string>
 #include <vector>
 
 namespace artery
 {
 
-class EnvironmentModelObject;
 class GlobalEnvironmentModel;
 class Middleware;
 class Sensor;
@@ -35,44 +33,12 @@ class SensorDetection;
 class LocalEnvironmentModel : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
 public:
-    using Object = std::weak_ptr<EnvironmentModelObject>;
-
-    class TrackingTime
-    {
-    public:
-        TrackingTime();
-        void tap();
-
-        omnetpp::SimTime first() const { return mFirst; }
-        omnetpp::SimTime last() const { return mLast; }
-
-    private:
-        omnetpp::SimTime mFirst;
-        omnetpp::SimTime mLast;
-    };
-
-    class Tracking
-    {
-    public:
-        using TrackingMap = std::map<const Sensor*, TrackingTime>;
-
-        Tracking(int id, const Sensor* sensor);
-
-        bool expired() const;
-        void update();
-        void tap(const Sensor*);
-
-        int id() const { return mId; }
-        const TrackingMap& sensors() const { return mSensors; }
-
-    private:
-        int mId;
-        TrackingMap mSensors;
-    };
-
-    using TrackedObjects = std::map<Object, Tracking, std::owner_less<Object>>;
-    using TrackedObject = typename TrackedObjects::value_type;
-
+    using Object = ObjectTracker::Object;
+    using TrackingTime = ObjectTracker::TrackingTime;
+    using Tracking = ObjectTracker::Tracking;
+    using TrackedObject = ObjectTracker::TrackedObject;
+    using TrackedObjects = ObjectTracker::TrackedObjects;
+    using Listener = ObjectTracker::Listener;
 
     LocalEnvironmentModel();
     virtual ~LocalEnvironmentModel() = default;
@@ -90,6 +56,11 @@ public:
      */
     void update();
 
+    /**
+     * Measures all local sensors being due and updates the local environment model afterwards
+     */
+    void measurement();
+
     /**
      * Complements the local database with the sensor data objects
      * @param objs Sensor detection result including objects and obstacles
@@ -100,7 +71,7 @@ public:
     /**
      * Get all currently seen objects by any local sensor
      */
-    const TrackedObjects& allObjects() const { return mObjects; }
+    const TrackedObjects& allObjects() const { return mTracker.objects(); }
 
     /**
      * Get list of all sensors attached to this local entity
@@ -109,13 +80,33 @@ public:
      */
     const std::vector<Sensor*>& getSensors() const { return mSensors; }
 
+    /**
+     * Get tracking of an object
+     * \param handle object handle
+     * \return tracking or nullptr if object is not tracked
+     */
+    const Tracking* getTracking(ObjectHandle handle) const;
+
+    /**
+     * Add listener notified about tracking changes
+     *
+     * Listeners are released when this LocalEnvironmentModel finishes.
+     * \param listener listener to be added
+     */
+    void addListener(Listener* listener);
+
+    /**
+     * Remove previously added listener
+     * \param listener listener to be removed
+     */
+    void removeListener(Listener* listener);
+
 private:
     void initializeSensors();
 
     Middleware* mMiddleware;
     GlobalEnvironmentModel* mGlobalEnvironmentModel;
-    int mTrackingCounter = 0;
-    TrackedObjects mObjects;
+    ObjectTracker mTracker;
     std::vector<Sensor*> mSensors;
 };
 
@@ -0,0 +1,116 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/ObjectHandleMap.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace artery
+{
+
+namespace
+{
+
+constexpr std::size_t MinimumSlots = 16;
+
+} // namespace
+
+constexpr std::size_t ObjectHandleMap::npos;
+
+std::size_t ObjectHandleMap::home(ObjectHandle handle) const
+{
+    // Fibonacci hashing spreads consecutive handles, number of slots is a power of two
+    const std::uint64_t hash = static_cast<std::uint64_t>(handle) * UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<std::size_t>(hash >> 32) & (mSlots.size() - 1);
+}
+
+std::size_t ObjectHandleMap::find(ObjectHandle handle) const
+{
+    if (mSlots.empty()) {
+        return npos;
+    }
+
+    const std::size_t mask = mSlots.size() - 1;
+    for (std::size_t i = home(handle);; i = (i + 1) & mask) {
+        const Slot& slot = mSlots[i];
+        if (slot.handle == handle) {
+            return slot.index;
+        } else if (slot.handle == NoObjectHandle) {
+            return npos;
+        }
+    }
+}
+
+void ObjectHandleMap::insert(ObjectHandle handle, std::size_t index)
+{
+    // keep load factor at most 0.5, i.e. probe sequences stay short and always hit an empty slot
+    if (2 * (mSize + 1) > mSlots.size()) {
+        grow();
+    }
+
+    const std::size_t mask = mSlots.size() - 1;
+    for (std::size_t i = home(handle);; i = (i + 1) & mask) {
+        Slot& slot = mSlots[i];
+        if (slot.handle == handle) {
+            slot.index = index;
+            return;
+        } else if (slot.handle == NoObjectHandle) {
+            slot.handle = handle;
+            slot.index = index;
+            ++mSize;
+            return;
+        }
+    }
+}
+
+void ObjectHandleMap::erase(ObjectHandle handle)
+{
+    if (mSlots.empty()) {
+        return;
+    }
+
+    const std::size_t mask = mSlots.size() - 1;
+    std::size_t hole = home(handle);
+    while (mSlots[hole].handle != handle) {
+        if (mSlots[hole].handle == NoObjectHandle) {
+            return;
+        }
+        hole = (hole + 1) & mask;
+    }
+
+    // shift back subsequent entries unless this would move them before their home slot
+    for (std::size_t i = (hole + 1) & mask; mSlots[i].handle != NoObjectHandle; i = (i + 1) & mask) {
+        const std::size_t k = home(mSlots[i].handle);
+        const bool stays = hole <= i ? (hole < k && k <= i) : (hole < k || k <= i);
+        if (!stays) {
+            mSlots[hole] = mSlots[i];
+            hole = i;
+        }
+    }
+
+    mSlots[hole] = Slot {};
+    --mSize;
+}
+
+void ObjectHandleMap::clear()
+{
+    std::fill(mSlots.begin(), mSlots.end(), Slot {});
+    mSize = 0;
+}
+
+void ObjectHandleMap::grow()
+{
+    std::vector<Slot> slots(std::max(MinimumSlots, 2 * mSlots.size()));
+    slots.swap(mSlots);
+    mSize = 0;
+    for (const Slot& slot : slots) {
+        if (slot.handle != NoObjectHandle) {
+            insert(slot.handle, slot.index);
+        }
+    }
+}
+
+} // namespace artery
@@ -0,0 +1,71 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_OBJECTHANDLEMAP_H_K2VQ8TSE
+#define ENVMOD_OBJECTHANDLEMAP_H_K2VQ8TSE
+
+#include "artery/envmod/EnvironmentModelObject.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * ObjectHandleMap maps object handles to indices, e.g. of a densely packed vector.
+ *
+ * Entries are stored in a single array using open addressing with linear probing.
+ * Erased entries are filled by shifting back subsequent entries, i.e. there are no tombstones.
+ */
+class ObjectHandleMap
+{
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * Find index mapped to handle
+     * \param handle object handle
+     * \return mapped index or npos
+     */
+    std::size_t find(ObjectHandle handle) const;
+
+    /**
+     * Map handle to index, replaces any previous mapping of this handle
+     * \param handle object handle
+     * \param index mapped index
+     */
+    void insert(ObjectHandle handle, std::size_t index);
+
+    /**
+     * Remove mapping of handle (if any)
+     * \param handle object handle
+     */
+    void erase(ObjectHandle handle);
+
+    /**
+     * Remove all mappings but keep allocated slots
+     */
+    void clear();
+
+    std::size_t size() const { return mSize; }
+
+private:
+    struct Slot
+    {
+        ObjectHandle handle = NoObjectHandle;
+        std::size_t index = npos;
+    };
+
+    std::size_t home(ObjectHandle) const;
+    void grow();
+
+    std::vector<Slot> mSlots;
+    std::size_t mSize = 0;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_OBJECTHANDLEMAP_H_K2VQ8TSE */
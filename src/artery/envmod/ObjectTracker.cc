@@ -0,0 +1,181 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/ObjectTracker.h"
+#include <algorithm>
+#include <utility>
+
+namespace artery
+{
+
+void ObjectTracker::tap(const std::shared_ptr<EnvironmentModelObject>& object, std::uint32_t generation,
+        const Sensor* sensor, const omnetpp::SimTime& validity, const omnetpp::SimTime& now)
+{
+    const ObjectHandle handle = object->getHandle();
+    const std::size_t index = mObjectIndex.find(handle);
+    if (index == ObjectHandleMap::npos) {
+        mObjectIndex.insert(handle, mObjects.size());
+        mObjects.emplace_back(object, Tracking { ++mTrackingCounter, sensor, now, validity });
+        mTrackingKeys.push_back(TrackingKey { handle, generation });
+        notifyStarted(mObjects.back(), sensor);
+    } else if (mTrackingKeys[index].generation != generation) {
+        // handle has been recycled for another object since last update
+        notifyLost(mObjects[index]);
+        mObjects[index] = TrackedObject { object, Tracking { ++mTrackingCounter, sensor, now, validity } };
+        mTrackingKeys[index].generation = generation;
+        notifyStarted(mObjects[index], sensor);
+    } else if (mObjects[index].second.tap(sensor, now, validity)) {
+        notifyStarted(mObjects[index], sensor);
+    }
+}
+
+void ObjectTracker::update(const omnetpp::SimTime& now, const Generation& generation)
+{
+    for (std::size_t i = 0; i < mObjects.size();) {
+        Tracking& tracking = mObjects[i].second;
+        if (mListeners.empty()) {
+            tracking.update(now);
+        } else {
+            const TrackedObject& object = mObjects[i];
+            tracking.update(now, [this, &object](const Sensor* sensor) { notifyLost(object, sensor); });
+        }
+
+        const TrackingKey& key = mTrackingKeys[i];
+        const bool removed = generation(key.handle) != key.generation;
+        if (removed || tracking.expired()) {
+            notifyLost(mObjects[i]);
+            eraseObject(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+auto ObjectTracker::find(ObjectHandle handle) const -> const Tracking*
+{
+    const std::size_t index = mObjectIndex.find(handle);
+    return index != ObjectHandleMap::npos ? &mObjects[index].second : nullptr;
+}
+
+void ObjectTracker::clear()
+{
+    mObjects.clear();
+    mTrackingKeys.clear();
+    mObjectIndex.clear();
+    mListeners.clear();
+}
+
+void ObjectTracker::eraseObject(std::size_t index)
+{
+    // move last object into gap to keep objects densely packed
+    mObjectIndex.erase(mTrackingKeys[index].handle);
+    const std::size_t last = mObjects.size() - 1;
+    if (index != last) {
+        mObjects[index] = std::move(mObjects[last]);
+        mTrackingKeys[index] = mTrackingKeys[last];
+        mObjectIndex.insert(mTrackingKeys[index].handle, index);
+    }
+    mObjects.pop_back();
+    mTrackingKeys.pop_back();
+}
+
+void ObjectTracker::addListener(Listener* listener)
+{
+    if (std::find(mListeners.begin(), mListeners.end(), listener) == mListeners.end()) {
+        mListeners.push_back(listener);
+    }
+}
+
+void ObjectTracker::removeListener(Listener* listener)
+{
+    mListeners.erase(std::remove(mListeners.begin(), mListeners.end(), listener), mListeners.end());
+}
+
+void ObjectTracker::notifyStarted(const TrackedObject& object, const Sensor* sensor)
+{
+    for (Listener* listener : mListeners) {
+        listener->trackingStarted(object, *sensor);
+    }
+}
+
+void ObjectTracker::notifyLost(const TrackedObject& object, const Sensor* sensor)
+{
+    for (Listener* listener : mListeners) {
+        listener->trackingLost(object, *sensor);
+    }
+}
+
+void ObjectTracker::notifyLost(const TrackedObject& object)
+{
+    // notify about all sensors still tracking this object
+    if (!mListeners.empty()) {
+        for (const auto& entry : object.second.sensors()) {
+            notifyLost(object, entry.first);
+        }
+    }
+}
+
+
+ObjectTracker::Tracking::Tracking(int id, const Sensor* sensor, const omnetpp::SimTime& now, const omnetpp::SimTime& validity) :
+    mId(id)
+{
+    mSensors.emplace_back(sensor, TrackingTime { now, validity });
+}
+
+bool ObjectTracker::Tracking::expired() const
+{
+    return mSensors.empty();
+}
+
+void ObjectTracker::Tracking::update(const omnetpp::SimTime& now, const std::function<void(const Sensor*)>& lost)
+{
+    // compact valid entries in place, i.e. like std::remove_if but reporting removed entries
+    auto kept = mSensors.begin();
+    for (auto it = mSensors.begin(); it != mSensors.end(); ++it) {
+        if (it->second.expiry() >= now) {
+            if (kept != it) {
+                *kept = std::move(*it);
+            }
+            ++kept;
+        } else if (lost) {
+            lost(it->first);
+        }
+    }
+    mSensors.erase(kept, mSensors.end());
+}
+
+bool ObjectTracker::Tracking::tap(const Sensor* sensor, const omnetpp::SimTime& now, const omnetpp::SimTime& validity)
+{
+    auto found = std::find_if(mSensors.begin(), mSensors.end(),
+            [sensor](const TrackingMap::value_type& entry) { return entry.first == sensor; });
+    if (found != mSensors.end()) {
+        found->second.tap(now);
+        return false;
+    } else {
+        mSensors.emplace_back(sensor, TrackingTime { now, validity });
+        return true;
+    }
+}
+
+auto ObjectTracker::Tracking::time(const Sensor* sensor) const -> const TrackingTime*
+{
+    auto found = std::find_if(mSensors.begin(), mSensors.end(),
+            [sensor](const TrackingMap::value_type& entry) { return entry.first == sensor; });
+    return found != mSensors.end() ? &found->second : nullptr;
+}
+
+
+ObjectTracker::TrackingTime::TrackingTime(const omnetpp::SimTime& now, const omnetpp::SimTime& validity) :
+    mFirst(now), mLast(now), mValidity(validity)
+{
+}
+
+void ObjectTracker::TrackingTime::tap(const omnetpp::SimTime& now)
+{
+    mLast = now;
+}
+
+} // namespace artery
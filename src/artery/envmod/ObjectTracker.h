@@ -0,0 +1,187 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_OBJECTTRACKER_H_T6WVZYWJ
+#define ENVMOD_OBJECTTRACKER_H_T6WVZYWJ
+
+#include "artery/envmod/EnvironmentModelObject.h"
+#include "artery/envmod/ObjectHandleMap.h"
+#include <boost/container/small_vector.hpp>
+#include <omnetpp/simtime.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace artery
+{
+
+class Sensor;
+
+/**
+ * ObjectTracker records which objects have been detected by which sensors
+ *
+ * This is the bookkeeping of LocalEnvironmentModel. It is independent of any OMNeT++ module,
+ * i.e. the current simulation time and object handle generations are passed in by the caller.
+ */
+class ObjectTracker
+{
+public:
+    using Object = std::weak_ptr<EnvironmentModelObject>;
+
+    class TrackingTime
+    {
+    public:
+        /**
+         * @param now time of first detection
+         * @param validity period a detection stays valid
+         */
+        TrackingTime(const omnetpp::SimTime& now, const omnetpp::SimTime& validity);
+        void tap(const omnetpp::SimTime& now);
+
+        omnetpp::SimTime first() const { return mFirst; }
+        omnetpp::SimTime last() const { return mLast; }
+        omnetpp::SimTime expiry() const { return mLast + mValidity; }
+
+    private:
+        omnetpp::SimTime mFirst;
+        omnetpp::SimTime mLast;
+        omnetpp::SimTime mValidity;
+    };
+
+    class Tracking
+    {
+    public:
+        // few sensors track an object usually, hence these are stored inline
+        using TrackingMap = boost::container::small_vector<std::pair<const Sensor*, TrackingTime>, 4>;
+
+        Tracking(int id, const Sensor* sensor, const omnetpp::SimTime& now, const omnetpp::SimTime& validity);
+
+        bool expired() const;
+
+        /**
+         * Remove sensors whose validity period has passed since their last detection
+         * @param now current simulation time
+         * @param lost invoked for each removed sensor (optional)
+         */
+        void update(const omnetpp::SimTime& now, const std::function<void(const Sensor*)>& lost = nullptr);
+
+        /**
+         * Record detection by a sensor
+         * @param sensor detecting sensor
+         * @param now current simulation time
+         * @param validity validity period of sensor's detections
+         * @return true if sensor has not been tracking this object before
+         */
+        bool tap(const Sensor* sensor, const omnetpp::SimTime& now, const omnetpp::SimTime& validity);
+
+        /**
+         * Get tracking time of a sensor
+         * @return tracking time or nullptr if sensor does not track this object
+         */
+        const TrackingTime* time(const Sensor*) const;
+
+        int id() const { return mId; }
+        const TrackingMap& sensors() const { return mSensors; }
+
+    private:
+        int mId;
+        TrackingMap mSensors;
+    };
+
+    using TrackedObject = std::pair<Object, Tracking>;
+    using TrackedObjects = std::vector<TrackedObject>; /*< densely packed, unordered */
+
+    /**
+     * Listener gets notified about changes of the tracking, i.e. listeners can
+     * maintain derived data incrementally instead of iterating all tracked objects.
+     *
+     * Repeated detections of an object by the same sensor are not notified,
+     * listeners look up the tracking times via find when needed.
+     */
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+
+        /**
+         * Sensor has started tracking an object
+         * @param object tracked object
+         * @param sensor detecting sensor
+         */
+        virtual void trackingStarted(const TrackedObject& object, const Sensor& sensor) = 0;
+
+        /**
+         * Sensor does not track an object any longer, e.g. because its detection expired or the object vanished
+         * @param object tracked object
+         * @param sensor sensor which lost track of the object
+         */
+        virtual void trackingLost(const TrackedObject& object, const Sensor& sensor) = 0;
+    };
+
+    using Generation = std::function<std::uint32_t(ObjectHandle)>;
+
+    /**
+     * Record detection of an object by a sensor
+     * \param object detected object
+     * \param generation current generation of object's handle
+     * \param sensor detecting sensor
+     * \param validity validity period of sensor's detections
+     * \param now current simulation time
+     */
+    void tap(const std::shared_ptr<EnvironmentModelObject>& object, std::uint32_t generation,
+            const Sensor* sensor, const omnetpp::SimTime& validity, const omnetpp::SimTime& now);
+
+    /**
+     * Remove expired and no longer existing objects
+     * \param now current simulation time
+     * \param generation yields current generation of an object handle
+     */
+    void update(const omnetpp::SimTime& now, const Generation& generation);
+
+    /**
+     * Get all tracked objects
+     */
+    const TrackedObjects& objects() const { return mObjects; }
+
+    /**
+     * Get tracking of an object
+     * \param handle object handle
+     * \return tracking or nullptr if object is not tracked
+     */
+    const Tracking* find(ObjectHandle handle) const;
+
+    /**
+     * Drop all tracked objects and listeners
+     */
+    void clear();
+
+    void addListener(Listener*);
+    void removeListener(Listener*);
+
+private:
+    struct TrackingKey
+    {
+        ObjectHandle handle;
+        std::uint32_t generation; /*< object handle's generation at start of tracking */
+    };
+
+    void eraseObject(std::size_t index);
+    void notifyStarted(const TrackedObject&, const Sensor*);
+    void notifyLost(const TrackedObject&, const Sensor*);
+    void notifyLost(const TrackedObject&);
+
+    int mTrackingCounter = 0;
+    TrackedObjects mObjects;
+    std::vector<TrackingKey> mTrackingKeys; /*< same order as mObjects */
+    ObjectHandleMap mObjectIndex; /*< object handle to index of mObjects */
+    std::vector<Listener*> mListeners;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_OBJECTTRACKER_H_T6WVZYWJ */
@@ -0,0 +1,59 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/Preselection.h"
+#include <boost/version.hpp>
+
+namespace artery
+{
+
+namespace
+{
+
+template<typename RT>
+typename RT::const_query_iterator
+query_intersections(const RT& rtree, const std::vector<Position>& area)
+{
+#if BOOST_VERSION >= 106000 && BOOST_VERSION < 106200
+    // Boost versions 1.60 and 1.61 do not compile without copy
+    geometry::Polygon area_copy;
+    boost::geometry::convert(area, area_copy);
+    auto predicate = boost::geometry::index::intersects(area_copy);
+#else
+    auto predicate = boost::geometry::index::intersects(area);
+#endif
+    return rtree.qbegin(predicate);
+}
+
+} // namespace
+
+std::vector<std::shared_ptr<EnvironmentModelObject>>
+preselectObjects(const ObjectRtree& rtree, const std::vector<std::shared_ptr<EnvironmentModelObject>>& objects,
+        ObjectHandle ego, const std::vector<Position>& area)
+{
+    std::vector<std::shared_ptr<EnvironmentModelObject>> objectsInSearchArea;
+    ObjectRtree::const_query_iterator it = query_intersections(rtree, area);
+    for (; it != rtree.qend(); ++it) {
+        const std::shared_ptr<EnvironmentModelObject>& object = objects[it->second];
+        if (it->second != ego && object->isVisible()) {
+            objectsInSearchArea.push_back(object);
+        }
+    }
+    return objectsInSearchArea;
+}
+
+std::vector<std::shared_ptr<EnvironmentModelObstacle>>
+preselectObstacles(const ObstacleRtree& rtree, const std::vector<Position>& area)
+{
+    std::vector<std::shared_ptr<EnvironmentModelObstacle>> obstacles;
+    ObstacleRtree::const_query_iterator it = query_intersections(rtree, area);
+    for (; it != rtree.qend(); ++it) {
+        obstacles.push_back(it->second);
+    }
+    return obstacles;
+}
+
+} // namespace artery
@@ -0,0 +1,49 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_PRESELECTION_H_YUCFMBLP
+#define ENVMOD_PRESELECTION_H_YUCFMBLP
+
+#include "artery/envmod/EnvironmentModelObject.h"
+#include "artery/envmod/EnvironmentModelObstacle.h"
+#include "artery/utility/Geometry.h"
+#include <boost/geometry/index/rtree.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace artery
+{
+
+using ObjectRtreeValue = std::pair<geometry::Box, ObjectHandle>;
+using ObjectRtree = boost::geometry::index::rtree<ObjectRtreeValue, boost::geometry::index::quadratic<16>>;
+using ObstacleRtreeValue = std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObstacle>>;
+using ObstacleRtree = boost::geometry::index::rtree<ObstacleRtreeValue, boost::geometry::index::rstar<16>>;
+
+/**
+ * Preselect all objects whose rtree boxes intersect the given area
+ * @param rtree object boxes
+ * @param objects objects indexed by their handles
+ * @param ego handle of the ego object (or NoObjectHandle), which is filtered out of the result
+ * @param area search polygon
+ * @return visible preselected objects
+ */
+std::vector<std::shared_ptr<EnvironmentModelObject>>
+preselectObjects(const ObjectRtree& rtree, const std::vector<std::shared_ptr<EnvironmentModelObject>>& objects,
+        ObjectHandle ego, const std::vector<Position>& area);
+
+/**
+ * Preselect all obstacles whose rtree boxes intersect the given area
+ * @param rtree obstacle boxes
+ * @param area search polygon
+ * @return preselected obstacles
+ */
+std::vector<std::shared_ptr<EnvironmentModelObstacle>>
+preselectObstacles(const ObstacleRtree& rtree, const std::vector<Position>& area);
+
+} // namespace artery
+
+#endif /* ENVMOD_PRESELECTION_H_YUCFMBLP */
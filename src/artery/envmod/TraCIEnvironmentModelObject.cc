@@ -8,7 +8,6 @@
 #include "artery/envmod/TraCIEnvironmentModelObject.h"
 #include "artery/traci/PersonController.h"
 #include "artery/traci/VehicleController.h"
-#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/units/cmath.hpp>
 #include <boost/units/systems/angle/degrees.hpp>
@@ -17,68 +16,11 @@
 namespace artery
 {
 
-namespace {
-
-// corner points of 1x1 square (heading east, front bumper at origin)
-const std::vector<Position> squareOutline = {
-    Position(0.0, 0.5), // front left
-    Position(0.0, -0.5), // front right
-    Position(-1.0, -0.5), // back right
-    Position(-1.0, 0.5) // back left
-};
-
-// attachment points for sensor
-const std::vector<Position> squareAttachmentPoints = {
-    Position(0.0, 0.0), // front middle
-    Position(-0.5, -0.5), // right middle
-    Position(-1.0, 0.0), // back middle
-    Position(-0.5, 0.5) // left middle
-};
-
-const Position squareCentrePoint(-0.5, 0.0);
-
-#if BOOST_VERSION < 106400
-boost::geometry::strategy::transform::ublas_transformer<double, 2, 2>
-transformObject(double length, double width, const Position& pos, Angle alpha)
-{
-    using namespace boost::geometry::strategy::transform;
-    using result_type = ublas_transformer<double, 2, 2>;
-    using matrix_type = boost::numeric::ublas::matrix<double>;
-
-    // scale square to vehicle dimensions
-    scale_transformer<double, 2, 2> scaling(length, width);
-    // rotate into driving direction
-    rotate_transformer<boost::geometry::radian, double, 2, 2> rotation(alpha.radian());
-    // move to given front bumper position
-    translate_transformer<double, 2, 2> translation(pos.x.value(), pos.y.value());
-
-    const matrix_type rotateAfterScale = prod(rotation.matrix(), scaling.matrix());
-    const matrix_type translateAfterRotateAfterScale = prod(translation.matrix(), rotateAfterScale);
-    return result_type { translateAfterRotateAfterScale };
-}
-#else
-boost::geometry::strategy::transform::matrix_transformer<double, 2, 2>
-transformObject(double length, double width, const Position& pos, Angle alpha)
-{
-    using namespace boost::geometry::strategy::transform;
-
-    // scale square to vehicle dimensions
-    scale_transformer<double, 2, 2> scaling(length, width);
-    // rotate into driving direction
-    rotate_transformer<boost::geometry::radian, double, 2, 2> rotation(alpha.radian());
-    // move to given front bumper position
-    translate_transformer<double, 2, 2> translation(pos.x.value(), pos.y.value());
-
-    return matrix_transformer<double, 2, 2> { translation.matrix() * rotation.matrix() * scaling.matrix() };
-}
-#endif
-
-}
-
-TraCIEnvironmentModelObject::TraCIEnvironmentModelObject(const traci::Controller* controller, uint32_t id) :
+TraCIEnvironmentModelObject::TraCIEnvironmentModelObject(const traci::Controller* controller, uint32_t id, ObjectHandle handle) :
     VehicleDataProvider(id),
     mController(controller)
 {
+    mHandle = handle;
     mLength = controller->getLength();
     mWidth = controller->getWidth();
     const auto halfWidth = mWidth * 0.5;
@@ -102,19 +44,24 @@ const VehicleDataProvider& TraCIEnvironmentModelObject::getVehicleData() const
 
 void TraCIEnvironmentModelObject::update()
 {
+    // nothing to do if the internal vdp is already up-to-date in this time step
+    if (VehicleDataProvider::updated() == omnetpp::simTime()) {
+        return;
+    }
+
     // Update the internal vdp
     VehicleDataProvider::update(getKinematics(*mController));
 
-    // Recalculate all time and position dependent attributes
+    // Recalculate all time and position dependent attributes in place, i.e. without any allocations
     using namespace boost::math::double_constants;
     Angle heading = -1.0 * (getVehicleData().heading() - 0.5 * pi * boost::units::si::radian);
-    auto affine = transformObject(mLength.value(), mWidth.value(), getVehicleData().position(), heading);
+    placeRectangle(getVehicleData().position(), heading);
+}
 
-    boost::geometry::transform(squareCentrePoint, mCentrePoint, affine);
-    mOutline.clear();
-    boost::geometry::transform(squareOutline, mOutline, affine);
-    mAttachmentPoints.clear();
-    boost::geometry::transform(squareAttachmentPoints, mAttachmentPoints, affine);
+Position TraCIEnvironmentModelObject::trackPosition()
+{
+    // front bumper position, whole object is within its length (plus half width) behind
+    return mController->getPosition();
 }
 
 EnvironmentModelObject::Heading TraCIEnvironmentModelObject::getHeading() const
@@ -129,7 +76,7 @@ EnvironmentModelObject::Heading TraCIEnvironmentModelObject::getHeading() const
     return opp_heading;
 }
 
-std::string TraCIEnvironmentModelObject::getExternalId() const
+const std::string& TraCIEnvironmentModelObject::getExternalId() const
 {
     return mController->getId();
 }
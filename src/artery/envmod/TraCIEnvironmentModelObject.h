@@ -26,8 +26,9 @@ public:
     /**
      * @param ctrl associated TraCI controller to this object
      * @param id station ID used by this object for application messages (e.g. CAM)
+     * @param handle object handle assigned by GlobalEnvironmentModel
      */
-    TraCIEnvironmentModelObject(const traci::Controller*, uint32_t id);
+    TraCIEnvironmentModelObject(const traci::Controller*, uint32_t id, ObjectHandle handle);
 
     /**
      * Get access to vehicle data provider for this object.
@@ -35,8 +36,9 @@ public:
     const VehicleDataProvider& getVehicleData() const;
 
     void update() override;
+    Position trackPosition() override;
     Heading getHeading() const override;
-    std::string getExternalId() const override;
+    const std::string& getExternalId() const override;
     bool isVisible() override;
 
 private:
@@ -0,0 +1,590 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+/**
+ * Micro-benchmark of the envmod sensor pipeline on synthetic worlds
+ *
+ * The world is a Manhattan grid of rectangular buildings with vehicles driving along its streets.
+ * Each vehicle carries one field-of-view sensor. Per step, all vehicles move, their objects are updated
+ * like TraCIEnvironmentModelObject and the object rtree is rebuilt. Every sensor then runs the code
+ * shared with FovSensor, GlobalEnvironmentModel and LocalEnvironmentModel: sensor cone transformation,
+ * rtree preselection, line of sight check and object tracking.
+ *
+ * No OMNeT++ kernel and no SUMO are involved, i.e. the modules themselves are not instantiated.
+ * Benchmark objects take the role of the TraCI controllers feeding the environment model objects.
+ *
+ * Finally, in-place object updates are compared with the boost.geometry matrix transformers
+ * TraCIEnvironmentModelObject used before, both in run time and in placement deviation.
+ */
+
+#include "artery/envmod/BaseEnvironmentModelObject.h"
+#include "artery/envmod/EnvironmentModelObstacle.h"
+#include "artery/envmod/ObjectTracker.h"
+#include "artery/envmod/Preselection.h"
+#include "artery/envmod/sensor/LineOfSightCheck.h"
+#include "artery/envmod/sensor/SensorConfiguration.h"
+#include "artery/utility/Geometry.h"
+#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/version.hpp>
+#include <omnetpp/simtime.h>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+std::size_t allocations = 0;
+
+} // namespace
+
+// count all heap allocations, single-threaded benchmark needs no atomics
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace artery
+{
+namespace
+{
+
+namespace bg = boost::geometry;
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+    double worldSize = 1000.0; /*< edge length of square world [m] */
+    double blockSize = 80.0; /*< edge length of building blocks [m] */
+    double streetWidth = 20.0; /*< width of streets between blocks [m] */
+    double vehicleDensity = 40.0; /*< vehicles per km street */
+    double range = 80.0; /*< sensor range [m] */
+    double angle = 60.0; /*< sensor opening angle [deg] */
+    unsigned segments = 4; /*< sensor cone segments */
+    std::string method = "rays"; /*< line of sight method: rays or sweep */
+    std::string kernel = "edges"; /*< line of sight kernel of rays method: edges, boost or validate */
+    unsigned steps = 50; /*< simulated steps */
+    double stepLength = 0.1; /*< step length [s] */
+    unsigned seed = 42; /*< random seed of vehicle placement */
+    unsigned objectUpdates = 5000; /*< objects of the object update comparison, 0 disables it */
+};
+
+/**
+ * Kinematics of a vehicle, i.e. what TraCI reports about it
+ */
+struct Kinematics
+{
+    double x, y; /*< front bumper centre */
+    double dx, dy; /*< unit driving direction */
+    double heading; /*< clockwise rotation of driving direction from east [rad] */
+    double speed;
+};
+
+/**
+ * Environment model object of a benchmark vehicle
+ *
+ * update() places the object like TraCIEnvironmentModelObject::update() but takes the
+ * kinematics from the benchmark instead of a TraCI controller.
+ */
+class BenchmarkObject : public BaseEnvironmentModelObject
+{
+public:
+    BenchmarkObject(const Kinematics& kinematics, ObjectHandle handle, double length, double width) :
+        mKinematics(kinematics), mId("vehicle" + std::to_string(handle))
+    {
+        mHandle = handle;
+        mLength = length * boost::units::si::meters;
+        mWidth = width * boost::units::si::meters;
+        mRadius = 0.5 * std::hypot(length, width) * boost::units::si::meters;
+        update();
+    }
+
+    void update() override { placeRectangle(Position { mKinematics.x, mKinematics.y }, getHeading()); }
+    const std::string& getExternalId() const override { return mId; }
+    bool isVisible() override { return true; }
+
+    Heading getHeading() const override
+    {
+        return Angle::from_radian(mKinematics.heading);
+    }
+
+private:
+    const Kinematics& mKinematics;
+    std::string mId;
+};
+
+#if BOOST_VERSION < 106400
+using MatrixTransformer = boost::geometry::strategy::transform::ublas_transformer<double, 2, 2>;
+#else
+using MatrixTransformer = boost::geometry::strategy::transform::matrix_transformer<double, 2, 2>;
+#endif
+
+/**
+ * Benchmark object placed like TraCIEnvironmentModelObject::update() before in-place updates
+ *
+ * Outline and attachment points are cleared and refilled through boost.geometry matrix transformers.
+ * This object is the reference for run time and placement of BenchmarkObject.
+ */
+class MatrixTransformObject : public BenchmarkObject
+{
+public:
+    MatrixTransformObject(const Kinematics& kinematics, ObjectHandle handle, double length, double width) :
+        BenchmarkObject(kinematics, handle, length, width), mKinematics(kinematics)
+    {
+        update();
+    }
+
+    void update() override
+    {
+        namespace bgt = boost::geometry::strategy::transform;
+
+        // scale square to vehicle dimensions
+        bgt::scale_transformer<double, 2, 2> scaling(mLength.value(), mWidth.value());
+        // rotate into driving direction
+        bgt::rotate_transformer<boost::geometry::radian, double, 2, 2> rotation(getHeading().radian());
+        // move to given front bumper position
+        bgt::translate_transformer<double, 2, 2> translation(mKinematics.x, mKinematics.y);
+#if BOOST_VERSION < 106400
+        const MatrixTransformer affine { prod(translation.matrix(), prod(rotation.matrix(), scaling.matrix())) };
+#else
+        const MatrixTransformer affine { translation.matrix() * rotation.matrix() * scaling.matrix() };
+#endif
+
+        bg::transform(squareCentrePoint, mCentrePoint, affine);
+        mOutline.clear();
+        bg::transform(squareOutline, mOutline, affine);
+        mPoints.clear();
+        bg::transform(squareAttachmentPoints, mPoints, affine);
+    }
+
+    const Position& getAttachmentPoint(const SensorPosition& pos) const override
+    {
+        switch (pos) {
+            case SensorPosition::FRONT:
+                return mPoints.at(0);
+            case SensorPosition::RIGHT:
+                return mPoints.at(1);
+            case SensorPosition::BACK:
+                return mPoints.at(2);
+            case SensorPosition::LEFT:
+                return mPoints.at(3);
+            default:
+                throw std::invalid_argument("invalid sensor attachment point");
+        }
+    }
+
+private:
+    // unit square templates of TraCIEnvironmentModelObject before in-place updates
+    static const std::vector<Position> squareOutline;
+    static const std::vector<Position> squareAttachmentPoints;
+    static const Position squareCentrePoint;
+
+    const Kinematics& mKinematics;
+    std::vector<Position> mPoints; /*< attachment points: front, right, back, left */
+};
+
+const std::vector<Position> MatrixTransformObject::squareOutline = {
+    Position(0.0, 0.5), Position(0.0, -0.5), Position(-1.0, -0.5), Position(-1.0, 0.5)
+};
+
+const std::vector<Position> MatrixTransformObject::squareAttachmentPoints = {
+    Position(0.0, 0.0), Position(-0.5, -0.5), Position(-1.0, 0.0), Position(-0.5, 0.5)
+};
+
+const Position MatrixTransformObject::squareCentrePoint { -0.5, 0.0 };
+
+struct Stage
+{
+    Clock::duration time = Clock::duration::zero();
+    std::size_t allocations = 0;
+
+    template<typename FN>
+    void run(FN fn)
+    {
+        const std::size_t allocationsBefore = ::allocations;
+        const Clock::time_point start = Clock::now();
+        fn();
+        time += Clock::now() - start;
+        allocations += ::allocations - allocationsBefore;
+    }
+};
+
+const double vehicleLength = 4.5;
+const double vehicleWidth = 1.8;
+const double trackingValidity = 0.2; /*< FovSensor's default validity period [s] */
+
+void usage(const char* program, const Options& defaults)
+{
+    std::cout << "Usage: " << program << " [--option value ...]\n"
+        << "  --world-size m      edge length of square world (" << defaults.worldSize << ")\n"
+        << "  --block-size m      edge length of building blocks (" << defaults.blockSize << ")\n"
+        << "  --street-width m    width of streets between blocks (" << defaults.streetWidth << ")\n"
+        << "  --vehicle-density n vehicles per km street (" << defaults.vehicleDensity << ")\n"
+        << "  --range m           sensor range (" << defaults.range << ")\n"
+        << "  --angle deg         sensor opening angle (" << defaults.angle << ")\n"
+        << "  --segments n        sensor cone segments (" << defaults.segments << ")\n"
+        << "  --method name       line of sight method, rays or sweep (" << defaults.method << ")\n"
+        << "  --kernel name       line of sight kernel, edges, boost or validate (" << defaults.kernel << ")\n"
+        << "  --steps n           simulated steps (" << defaults.steps << ")\n"
+        << "  --step-length s     length of simulated steps (" << defaults.stepLength << ")\n"
+        << "  --seed n            seed of vehicle placement (" << defaults.seed << ")\n"
+        << "  --object-updates n  objects of the object update comparison, 0 disables it (" << defaults.objectUpdates << ")\n";
+}
+
+template<typename T>
+void takeOption(std::map<std::string, std::string>& values, const char* key, T& value)
+{
+    auto found = values.find(key);
+    if (found != values.end()) {
+        value = static_cast<T>(std::stod(found->second));
+        values.erase(found);
+    }
+}
+
+void takeOption(std::map<std::string, std::string>& values, const char* key, std::string& value)
+{
+    auto found = values.find(key);
+    if (found != values.end()) {
+        value = found->second;
+        values.erase(found);
+    }
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options options;
+    std::map<std::string, std::string> values;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            usage(argv[0], options);
+            std::exit(EXIT_SUCCESS);
+        } else if (arg.compare(0, 2, "--") != 0 || i + 1 >= argc) {
+            throw std::invalid_argument("malformed argument " + arg);
+        }
+        values[arg.substr(2)] = argv[++i];
+    }
+
+    takeOption(values, "world-size", options.worldSize);
+    takeOption(values, "block-size", options.blockSize);
+    takeOption(values, "street-width", options.streetWidth);
+    takeOption(values, "vehicle-density", options.vehicleDensity);
+    takeOption(values, "range", options.range);
+    takeOption(values, "angle", options.angle);
+    takeOption(values, "segments", options.segments);
+    takeOption(values, "steps", options.steps);
+    takeOption(values, "step-length", options.stepLength);
+    takeOption(values, "seed", options.seed);
+    takeOption(values, "object-updates", options.objectUpdates);
+
+    takeOption(values, "method", options.method);
+    takeOption(values, "kernel", options.kernel);
+
+    if (!values.empty()) {
+        throw std::invalid_argument("unknown option --" + values.begin()->first);
+    } else if (options.blockSize <= 0.0 || options.streetWidth <= 2.0 * vehicleWidth) {
+        throw std::invalid_argument("blocks and streets are too small");
+    }
+    return options;
+}
+
+std::vector<std::shared_ptr<EnvironmentModelObstacle>> createBuildings(const Options& options)
+{
+    std::vector<std::shared_ptr<EnvironmentModelObstacle>> buildings;
+    const double pitch = options.blockSize + options.streetWidth;
+    for (double x = options.streetWidth; x + options.blockSize <= options.worldSize; x += pitch) {
+        for (double y = options.streetWidth; y + options.blockSize <= options.worldSize; y += pitch) {
+            // clockwise open ring as expected by boost.geometry for artery polygons
+            buildings.push_back(std::make_shared<EnvironmentModelObstacle>("building" + std::to_string(buildings.size()),
+                std::vector<Position> {
+                    Position { x, y }, Position { x, y + options.blockSize },
+                    Position { x + options.blockSize, y + options.blockSize }, Position { x + options.blockSize, y }
+                }));
+        }
+    }
+    return buildings;
+}
+
+std::vector<Kinematics> createVehicles(const Options& options, std::size_t count)
+{
+    const double pitch = options.blockSize + options.streetWidth;
+    const unsigned streets = static_cast<unsigned>(options.worldSize / pitch) + 1;
+
+    std::mt19937 rng(options.seed);
+    std::uniform_int_distribution<unsigned> street(0, streets - 1);
+    std::uniform_real_distribution<double> offset(0.0, options.worldSize);
+    std::uniform_real_distribution<double> speed(5.0, 15.0);
+    std::bernoulli_distribution flip;
+
+    std::vector<Kinematics> vehicles(count);
+    for (Kinematics& vehicle : vehicles) {
+        // drive on the right lane of horizontal or vertical streets
+        const double centre = street(rng) * pitch + 0.5 * options.streetWidth;
+        const double sign = flip(rng) ? 1.0 : -1.0;
+        const double lane = centre - sign * 0.5 * vehicleWidth;
+        if (flip(rng)) {
+            vehicle.x = offset(rng);
+            vehicle.y = lane;
+            vehicle.dx = sign;
+            vehicle.dy = 0.0;
+        } else {
+            vehicle.x = lane;
+            vehicle.y = offset(rng);
+            vehicle.dx = 0.0;
+            vehicle.dy = sign;
+        }
+        vehicle.heading = std::atan2(-vehicle.dy, vehicle.dx);
+        vehicle.speed = speed(rng);
+    }
+    return vehicles;
+}
+
+std::vector<Kinematics> createVehicles(const Options& options)
+{
+    const double pitch = options.blockSize + options.streetWidth;
+    const unsigned streets = static_cast<unsigned>(options.worldSize / pitch) + 1;
+    const double streetLength = 2.0 * streets * options.worldSize;
+    return createVehicles(options, static_cast<std::size_t>(options.vehicleDensity * streetLength / 1000.0));
+}
+
+void moveVehicle(Kinematics& vehicle, const Options& options)
+{
+    const double distance = vehicle.speed * options.stepLength;
+    vehicle.x = std::fmod(vehicle.x + vehicle.dx * distance + options.worldSize, options.worldSize);
+    vehicle.y = std::fmod(vehicle.y + vehicle.dy * distance + options.worldSize, options.worldSize);
+}
+
+void report(const char* name, const Stage& stage, std::size_t count, const char* unit = "detection")
+{
+    const double ns = std::chrono::duration<double, std::nano>(stage.time).count();
+    std::cout << "  " << name << ": " << ns / count << " ns/" << unit << ", "
+        << static_cast<double>(stage.allocations) / count << " allocations/" << unit << "\n";
+}
+
+double deviation(const Position& a, const Position& b)
+{
+    return std::hypot(a.x.value() - b.x.value(), a.y.value() - b.y.value());
+}
+
+double deviation(const EnvironmentModelObject& a, const EnvironmentModelObject& b)
+{
+    double max = deviation(a.getCentrePoint(), b.getCentrePoint());
+    for (std::size_t i = 0; i < a.getOutline().size(); ++i) {
+        max = std::max(max, deviation(a.getOutline()[i], b.getOutline().at(i)));
+    }
+    for (SensorPosition pos : { SensorPosition::FRONT, SensorPosition::RIGHT, SensorPosition::BACK, SensorPosition::LEFT }) {
+        max = std::max(max, deviation(a.getAttachmentPoint(pos), b.getAttachmentPoint(pos)));
+    }
+    return max;
+}
+
+/**
+ * Compare in-place object updates with the former boost.geometry matrix transformers
+ *
+ * Both object kinds follow the same vehicles. Their placements are compared after each step.
+ */
+void compareObjectUpdates(const Options& options)
+{
+    std::vector<Kinematics> vehicles = createVehicles(options, options.objectUpdates);
+    std::vector<std::unique_ptr<MatrixTransformObject>> references;
+    std::vector<std::unique_ptr<BenchmarkObject>> objects;
+    for (std::size_t i = 0; i < vehicles.size(); ++i) {
+        references.emplace_back(new MatrixTransformObject(vehicles[i], i, vehicleLength, vehicleWidth));
+        objects.emplace_back(new BenchmarkObject(vehicles[i], i, vehicleLength, vehicleWidth));
+    }
+
+    Stage matrixTransformers, inPlace;
+    double maxDeviation = 0.0;
+    for (unsigned step = 0; step < options.steps; ++step) {
+        for (Kinematics& vehicle : vehicles) {
+            moveVehicle(vehicle, options);
+        }
+
+        matrixTransformers.run([&]() {
+            for (const auto& reference : references) {
+                reference->update();
+            }
+        });
+        inPlace.run([&]() {
+            for (const auto& object : objects) {
+                object->update();
+            }
+        });
+
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            maxDeviation = std::max(maxDeviation, deviation(*references[i], *objects[i]));
+        }
+    }
+
+    const std::size_t updates = std::size_t(options.steps) * vehicles.size();
+    std::cout << "object updates: " << vehicles.size() << " objects, " << options.steps << " steps, "
+        << maxDeviation << " m maximum deviation\n";
+    report("matrix transformers", matrixTransformers, updates, "object");
+    report("in place", inPlace, updates, "object");
+}
+
+int run(const Options& options)
+{
+    const std::vector<std::shared_ptr<EnvironmentModelObstacle>> buildings = createBuildings(options);
+    std::vector<Kinematics> vehicles = createVehicles(options);
+    LineOfSightCheck lineOfSightCheck {
+        determineLineOfSightMethod(options.method), determineLineOfSightKernel(options.kernel)
+    };
+
+    SensorConfigFov config;
+    config.fieldOfView.range = options.range * boost::units::si::meters;
+    config.fieldOfView.angle = options.angle * boost::units::degree::degrees;
+    config.numSegments = options.segments;
+    const std::vector<Position> coneTemplate = createSensorArc(config, Position { 0.0, 0.0 }, Angle { 0.0 });
+
+    // objects are indexed by their handles like in GlobalEnvironmentModel
+    std::vector<std::shared_ptr<EnvironmentModelObject>> objects;
+    for (std::size_t i = 0; i < vehicles.size(); ++i) {
+        objects.push_back(std::make_shared<BenchmarkObject>(vehicles[i], i, vehicleLength, vehicleWidth));
+    }
+
+    std::vector<ObstacleRtreeValue> obstacleValues;
+    for (const auto& building : buildings) {
+        obstacleValues.emplace_back(bg::return_envelope<geometry::Box>(building->getOutline()), building);
+    }
+    const ObstacleRtree obstacleRtree(obstacleValues.begin(), obstacleValues.end());
+
+    // cone buffer is reused across sensors like the one of FovSensor
+    ObjectRtree objectRtree;
+    std::vector<ObjectRtreeValue> objectValues;
+    std::vector<Position> cone;
+    std::vector<std::shared_ptr<EnvironmentModelObject>> candidates;
+    std::vector<std::shared_ptr<EnvironmentModelObstacle>> blockers;
+    SensorDetection detection;
+    std::vector<ObjectTracker> trackers(vehicles.size());
+    const ObjectTracker::Generation generation = [](ObjectHandle) { return 0; };
+    const omnetpp::SimTime validity = trackingValidity;
+
+    Stage refresh, preselection, lineOfSight, tracking;
+    std::size_t detections = 0;
+    std::size_t numCandidates = 0;
+    std::size_t numBlockers = 0;
+
+    for (unsigned step = 0; step < options.steps; ++step) {
+        const omnetpp::SimTime now = step * options.stepLength;
+        for (Kinematics& vehicle : vehicles) {
+            moveVehicle(vehicle, options);
+        }
+
+        refresh.run([&]() {
+            objectValues.clear();
+            for (const auto& object : objects) {
+                object->update();
+                objectValues.emplace_back(bg::return_envelope<geometry::Box>(object->getOutline()), object->getHandle());
+            }
+            objectRtree = ObjectRtree(objectValues.begin(), objectValues.end());
+        });
+
+        for (const auto& ego : objects) {
+            preselection.run([&]() {
+                transformSensorCone(coneTemplate, ego->getAttachmentPoint(SensorPosition::FRONT), ego->getHeading(), cone);
+                candidates = preselectObjects(objectRtree, objects, ego->getHandle(), cone);
+                blockers = preselectObstacles(obstacleRtree, cone);
+            });
+            numCandidates += candidates.size();
+            numBlockers += blockers.size();
+
+            lineOfSight.run([&]() {
+                detection = SensorDetection {};
+                detection.sensorOrigin = ego->getAttachmentPoint(SensorPosition::FRONT);
+                detection.sensorCone = std::move(cone);
+                lineOfSightCheck.detect(detection, candidates, blockers, false);
+                cone = std::move(detection.sensorCone);
+            });
+            detections += detection.objects.size();
+
+            tracking.run([&]() {
+                // single anonymous sensor per vehicle, the tracker only compares sensor pointers
+                ObjectTracker& tracker = trackers[ego->getHandle()];
+                for (const auto& object : detection.objects) {
+                    tracker.tap(object, 0, nullptr, validity, now);
+                }
+                tracker.update(now, generation);
+            });
+        }
+    }
+
+    const std::size_t sensors = std::size_t(options.steps) * vehicles.size();
+    std::cout << "world: " << options.worldSize << " m x " << options.worldSize << " m, "
+        << buildings.size() << " buildings, " << vehicles.size() << " vehicles\n";
+    std::cout << "sensor: " << options.range << " m range, " << options.angle << " deg opening, "
+        << options.segments << " segments, " << options.method << " line of sight";
+    if (options.method == "rays") {
+        std::cout << " with " << options.kernel << " kernel";
+    }
+    std::cout << "\n";
+    if (sensors == 0 || detections == 0) {
+        std::cout << "no detections, increase steps or vehicle density\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << options.steps << " steps: " << sensors << " measurements, " << detections << " detections, "
+        << static_cast<double>(numCandidates) / sensors << " objects and "
+        << static_cast<double>(numBlockers) / sensors << " obstacles preselected per measurement\n";
+    report("object refresh", refresh, detections);
+    report("preselection", preselection, detections);
+    report("line of sight", lineOfSight, detections);
+    report("tracking", tracking, detections);
+
+    Stage total;
+    total.time = refresh.time + preselection.time + lineOfSight.time + tracking.time;
+    total.allocations = refresh.allocations + preselection.allocations + lineOfSight.allocations + tracking.allocations;
+    report("total", total, detections);
+
+    if (options.objectUpdates > 0 && options.steps > 0) {
+        compareObjectUpdates(options);
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+} // namespace artery
+
+int main(int argc, char** argv)
+{
+    // SimTime needs its scale without a simulation kernel setting it up
+    omnetpp::SimTime::setScaleExp(-12);
+
+    try {
+        return artery::run(artery::parseOptions(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "envmod benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+}
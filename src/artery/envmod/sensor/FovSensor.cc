@@ -10,14 +10,9 @@
 #include "artery/envmod/sensor/SensorDetection.h"
 #include "artery/envmod/LocalEnvironmentModel.h"
 #include "artery/envmod/EnvironmentModelObstacle.h"
-#include <boost/geometry/geometries/register/linestring.hpp>
-#include <unordered_set>
 
 using namespace omnetpp;
 
-using LineOfSight = std::array<artery::Position, 2>;
-BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
-
 namespace artery
 {
 
@@ -36,6 +31,9 @@ void FovSensor::finish()
         mLinesOfSightFigure = nullptr;
         mObstaclesFigure = nullptr;
         mObjectsFigure = nullptr;
+        mLineOfSightPool.assign(nullptr);
+        mObstaclePool.assign(nullptr);
+        mObjectPool.assign(nullptr);
     }
     BaseSensor::finish();
 }
@@ -63,6 +61,31 @@ void FovSensor::initialize()
     mFovConfig.fieldOfView.angle = par("fovAngle").doubleValue() * boost::units::degree::degrees;
     mFovConfig.numSegments = par("numSegments");
     mFovConfig.doLineOfSightCheck = par("doLineOfSightCheck");
+    mFovConfig.lineOfSightMethod = determineLineOfSightMethod(par("lineOfSightMethod"));
+    mFovConfig.lineOfSightKernel = determineLineOfSightKernel(par("lineOfSightKernel"));
+    mLineOfSight = LineOfSightCheck { mFovConfig.lineOfSightMethod, mFovConfig.lineOfSightKernel };
+
+    mMeasurementInterval = par("measurementInterval");
+    mNextMeasurement = par("measurementPhase");
+    if (mMeasurementInterval < SimTime::ZERO) {
+        throw cRuntimeError("measurementInterval must not be negative");
+    } else if (mNextMeasurement < SimTime::ZERO) {
+        throw cRuntimeError("measurementPhase must not be negative");
+    }
+
+    if (mFovConfig.fieldOfView.range <= 0.0 * boost::units::si::meter) {
+        throw cRuntimeError("sensor range is 0 meter or less");
+    } else if (mFovConfig.fieldOfView.angle > 360.0 * boost::units::degree::degrees) {
+        throw cRuntimeError("sensor opening angle exceeds 360 degree");
+    }
+
+    // rigid transformations keep the cone valid, i.e. preselection can skip validity checks
+    mSensorConeTemplate = createSensorArc(mFovConfig, Position { 0.0, 0.0 }, Angle { 0.0 });
+    boost::geometry::validity_failure_type failure;
+    if (!boost::geometry::is_valid(mSensorConeTemplate, failure)) {
+        std::string error_msg = boost::geometry::validity_failure_type_message(failure);
+        throw cRuntimeError("sensor cone polygon is invalid: %s", error_msg.c_str());
+    }
 
     initializeVisualization();
 }
@@ -70,76 +93,27 @@ void FovSensor::initialize()
 void FovSensor::measurement()
 {
     Enter_Method("measurement");
-    auto detection = detectObjects();
+    applyDetection(detectObjects());
+}
+
+void FovSensor::applyDetection(SensorDetection&& detection)
+{
+    Enter_Method("applyDetection");
     mLocalEnvironmentModel->complementObjects(detection, *this);
-    mLastDetection = std::move(detection);
+    mSensorConeBuffer = std::move(mLastDetection.exchange(std::move(detection)).sensorCone);
 }
 
 SensorDetection FovSensor::detectObjects() const
 {
     namespace bg = boost::geometry;
-    if (mFovConfig.fieldOfView.range <= 0.0 * boost::units::si::meter) {
-        throw std::runtime_error("sensor range is 0 meter or less");
-    } else if (mFovConfig.fieldOfView.angle > 360.0 * boost::units::degree::degrees) {
-        throw std::runtime_error("sensor opening angle exceeds 360 degree");
-    }
-
     SensorDetection detection = createSensorCone();
-    auto preselObjectsInSensorRange = mGlobalEnvironmentModel->preselectObjects(mFovConfig.egoID, detection.sensorCone);
+    auto preselObjectsInSensorRange = mGlobalEnvironmentModel->preselectObjects(getEgoHandle(), detection.sensorCone, false);
 
     // get obstacles intersecting with sensor cone
-    auto obstacleIntersections = mGlobalEnvironmentModel->preselectObstacles(detection.sensorCone);
-
-    if (mFovConfig.doLineOfSightCheck)
-    {
-        std::unordered_set<std::shared_ptr<EnvironmentModelObstacle>> blockingObstacles;
-
-        // check if objects in sensor cone are hidden by another object or an obstacle
-        for (const auto& object : preselObjectsInSensorRange)
-        {
-            for (const auto& objectPoint : object->getOutline())
-            {
-                // skip objects points outside of sensor cone
-                if (!bg::covered_by(objectPoint, detection.sensorCone)) {
-                    continue;
-                }
-
-                LineOfSight lineOfSight;
-                lineOfSight[0] = detection.sensorOrigin;
-                lineOfSight[1] = objectPoint;
-
-                bool noVehicleOccultation = std::none_of(preselObjectsInSensorRange.begin(), preselObjectsInSensorRange.end(),
-                        [&](const std::shared_ptr<EnvironmentModelObject>& object) {
-                            return bg::crosses(lineOfSight, object->getOutline());
-                        });
-
-                bool noObstacleOccultation = std::none_of(obstacleIntersections.begin(), obstacleIntersections.end(),
-                        [&](const std::shared_ptr<EnvironmentModelObstacle>& obstacle) {
-                            ASSERT(obstacle);
-                            if (bg::intersects(lineOfSight, obstacle->getOutline())) {
-                                blockingObstacles.insert(obstacle);
-                                return true;
-                            } else {
-                                return false;
-                            }
-                        });
-
-                if (noVehicleOccultation && noObstacleOccultation) {
-                    if (detection.objects.empty() || detection.objects.back() != object) {
-                        detection.objects.push_back(object);
-                    }
-
-                    if (mDrawLinesOfSight) {
-                        detection.visiblePoints.push_back(objectPoint);
-                    } else {
-                        // no need to check other object points in detail except for visualization
-                        break;
-                    }
-                }
-            } // for each (corner) point of object polygon
-        } // for each object
-
-        detection.obstacles.assign(blockingObstacles.begin(), blockingObstacles.end());
+    auto obstacleIntersections = mGlobalEnvironmentModel->preselectObstacles(detection.sensorCone, false);
+
+    if (mFovConfig.doLineOfSightCheck) {
+        mLineOfSight.detect(detection, preselObjectsInSensorRange, obstacleIntersections, mDrawLinesOfSight);
     } else {
         for (const auto& object : preselObjectsInSensorRange) {
             // preselection: object's bounding box and sensor cone's bounding box intersect
@@ -156,16 +130,39 @@ SensorDetection FovSensor::detectObjects() const
 SensorDetection FovSensor::createSensorCone() const
 {
     SensorDetection detection;
-    const auto& egoObj = mGlobalEnvironmentModel->getObject(mFovConfig.egoID);
+    const auto& egoObj = mGlobalEnvironmentModel->getObject(getEgoHandle());
     if (egoObj) {
         detection.sensorOrigin = egoObj->getAttachmentPoint(mFovConfig.sensorPosition);
-        detection.sensorCone = createSensorArc(mFovConfig, *egoObj);
+        transformSensorCone(detection.sensorOrigin, egoObj->getHeading(), detection.sensorCone);
     } else {
         throw std::runtime_error("no object found for ID " + mFovConfig.egoID);
     }
     return detection;
 }
 
+bool FovSensor::getPreselectionArea(geometry::Box& area) const
+{
+    // objects are only preselected within the sensor cone
+    SensorDetection detection = createSensorCone();
+    area = boost::geometry::return_envelope<geometry::Box>(detection.sensorCone);
+    mSensorConeBuffer = std::move(detection.sensorCone);
+    return true;
+}
+
+ObjectHandle FovSensor::getEgoHandle() const
+{
+    if (mEgoHandle == NoObjectHandle && !mFovConfig.egoID.empty()) {
+        mEgoHandle = mGlobalEnvironmentModel->getObjectHandle(mFovConfig.egoID);
+    }
+    return mEgoHandle;
+}
+
+void FovSensor::transformSensorCone(const Position& origin, const Angle& heading, std::vector<Position>& cone) const
+{
+    cone = std::move(mSensorConeBuffer);
+    artery::transformSensorCone(mSensorConeTemplate, origin, heading, cone);
+}
+
 void FovSensor::initializeVisualization()
 {
     assert(mGroupFigure);
@@ -186,6 +183,10 @@ void FovSensor::initializeVisualization()
     if(mDrawLinesOfSight && !mLinesOfSightFigure) {
         mLinesOfSightFigure = new cGroupFigure("lines of sight");
         mGroupFigure->addFigure(mLinesOfSightFigure);
+        mLineOfSightPool.assign(mLinesOfSightFigure, [this](cLineFigure* line) {
+            line->setLineColor(mColor);
+            line->setLineStyle(cFigure::LINE_DASHED);
+        });
     } else if (!mDrawLinesOfSight && mLinesOfSightFigure) {
         delete mLinesOfSightFigure->removeFromParent();
         mLinesOfSightFigure = nullptr;
@@ -194,6 +195,11 @@ void FovSensor::initializeVisualization()
     if (drawObstacles && !mObstaclesFigure) {
         mObstaclesFigure = new cGroupFigure("obstacles");
         mGroupFigure->addFigure(mObstaclesFigure);
+        mObstaclePool.assign(mObstaclesFigure, [this](cPolygonFigure* polygon) {
+            polygon->setFilled(true);
+            polygon->setFillColor(mColor);
+            polygon->setLineColor(cFigure::BLUE);
+        });
     } else if (!drawObstacles && mObstaclesFigure) {
         delete mObstaclesFigure->removeFromParent();
         mObstaclesFigure = nullptr;
@@ -202,6 +208,11 @@ void FovSensor::initializeVisualization()
     if (drawObjects && !mObjectsFigure) {
         mObjectsFigure = new cGroupFigure("objects");
         mGroupFigure->addFigure(mObjectsFigure);
+        mObjectPool.assign(mObjectsFigure, [this](cPolygonFigure* polygon) {
+            polygon->setFilled(true);
+            polygon->setFillColor(mColor);
+            polygon->setLineColor(cFigure::RED);
+        });
     } else if (!drawObjects && mObjectsFigure) {
         delete mObjectsFigure->removeFromParent();
         mObjectsFigure = nullptr;
@@ -216,7 +227,23 @@ const FieldOfView& FovSensor::getFieldOfView() const
 omnetpp::SimTime FovSensor::getValidityPeriod() const
 {
     using namespace omnetpp;
-    return SimTime { 200, SIMTIME_MS };
+    // keep objects tracked in between scheduled measurements
+    return SimTime { 200, SIMTIME_MS } + mMeasurementInterval;
+}
+
+bool FovSensor::isMeasurementDue(const omnetpp::SimTime& now)
+{
+    if (mMeasurementInterval == SimTime::ZERO) {
+        return true;
+    } else if (now < mNextMeasurement) {
+        return false;
+    }
+
+    // skip all slots up to now, e.g. when refresh interval exceeds measurement interval
+    while (mNextMeasurement <= now) {
+        mNextMeasurement += mMeasurementInterval;
+    }
+    return true;
 }
 
 SensorPosition FovSensor::position() const
@@ -247,64 +274,38 @@ void FovSensor::refreshDisplay() const
     }
 
     if (mSensorConeFigure) {
-        std::vector<cFigure::Point> points;
-        for (const auto& position : mLastDetection->sensorCone) {
-            points.push_back(cFigure::Point { position.x.value(), position.y.value() });
-        }
-        mSensorConeFigure->setPoints(points);
+        setFigurePoints(mSensorConeFigure, mLastDetection->sensorCone);
     }
 
     if (mLinesOfSightFigure) {
-        // remove previous lines
-        while (mLinesOfSightFigure->getNumFigures() > 0) {
-            delete mLinesOfSightFigure->removeFigure(0);
-        }
-
-        const Position& startPoint = mLastDetection->sensorOrigin;
+        const cFigure::Point startPoint { mLastDetection->sensorOrigin.x.value(), mLastDetection->sensorOrigin.y.value() };
+        mLineOfSightPool.begin();
         for (const Position& endPoint : mLastDetection->visiblePoints) {
-            auto line = new cLineFigure();
-            line->setLineColor(mColor);
-            line->setLineStyle(cFigure::LINE_DASHED);
-            line->setStart(cFigure::Point { startPoint.x.value(), startPoint.y.value() });
+            auto line = mLineOfSightPool.acquire();
+            line->setStart(startPoint);
             line->setEnd(cFigure::Point { endPoint.x.value(), endPoint.y.value() });
-            mLinesOfSightFigure->addFigure(line);
         }
+        mLineOfSightPool.end();
     }
 
     if (mObstaclesFigure) {
-        // remove previous obstacles
-        while (mObstaclesFigure->getNumFigures() > 0) {
-            delete mObstaclesFigure->removeFigure(0);
-        }
-
+        mObstaclePool.begin();
         for (const auto& obstacle : mLastDetection->obstacles) {
-            auto polygon = new cPolygonFigure(obstacle->getObstacleId().c_str());
-            polygon->setFilled(true);
-            polygon->setFillColor(mColor);
-            polygon->setLineColor(cFigure::BLUE);
-            for (const auto& position : obstacle->getOutline()) {
-                polygon->addPoint(cFigure::Point { position.x.value(), position.y.value() });
-            }
-            mObstaclesFigure->addFigure(polygon);
+            auto polygon = mObstaclePool.acquire();
+            polygon->setName(obstacle->getObstacleId().c_str());
+            setFigurePoints(polygon, obstacle->getOutline());
         }
+        mObstaclePool.end();
     }
 
     if (mObjectsFigure) {
-        // remove previous objects
-        while (mObjectsFigure->getNumFigures() > 0) {
-            delete mObjectsFigure->removeFigure(0);
-        }
-
+        mObjectPool.begin();
         for (const auto& object : mLastDetection->objects) {
-            auto polygon = new cPolygonFigure(object->getExternalId().c_str());
-            polygon->setFilled(true);
-            polygon->setFillColor(mColor);
-            polygon->setLineColor(cFigure::RED);
-            for (const auto& position : object->getOutline()) {
-                polygon->addPoint(cFigure::Point { position.x.value(), position.y.value() });
-            }
-            mObjectsFigure->addFigure(polygon);
+            auto polygon = mObjectPool.acquire();
+            polygon->setName(object->getExternalId().c_str());
+            setFigurePoints(polygon, object->getOutline());
         }
+        mObjectPool.end();
     }
 }
 
@@ -7,9 +7,11 @@
 #ifndef ENVMOD_FOVRSENSOR_H_BCY7WDMB
 #define ENVMOD_FOVRSENSOR_H_BCY7WDMB
 
+#include "artery/envmod/FigurePool.h"
 #include "artery/envmod/sensor/SensorConfiguration.h"
 #include "artery/envmod/sensor/SensorDetection.h"
 #include "artery/envmod/sensor/BaseSensor.h"
+#include "artery/envmod/sensor/LineOfSightCheck.h"
 #include <omnetpp/ccanvas.h>
 #include <memory>
 #include <functional>
@@ -26,10 +28,14 @@ public:
     const FieldOfView& getFieldOfView() const;
     SensorPosition position() const override;
     omnetpp::SimTime getValidityPeriod() const override;
+    bool isMeasurementDue(const omnetpp::SimTime&) override;
+    bool getPreselectionArea(geometry::Box&) const override;
     const std::string& getSensorCategory() const override;
     const std::string getSensorName() const override;
     void setSensorName(const std::string& name) override;
     SensorDetection detectObjects() const override;
+    bool hasDeferrableMeasurement() const override { return true; }
+    void applyDetection(SensorDetection&&) override;
 
 protected:
     template<typename T>
@@ -37,6 +43,7 @@ protected:
     {
     public:
         void operator=(T&& t) { mValue = std::move(t); mFlag = true; }
+        T exchange(T&& t) { T old = std::move(mValue); mValue = std::move(t); mFlag = true; return old; }
         operator bool() const { bool tmp = mFlag; mFlag = false; return tmp; }
         const T* operator->() const { return &mValue; }
         const T& operator*() const { return mValue; }
@@ -52,17 +59,47 @@ protected:
     void refreshDisplay() const override;
     virtual SensorDetection createSensorCone() const;
 
+    /**
+     * Place precomputed sensor cone at given position
+     * @param origin sensor origin
+     * @param heading sensor carrier's heading
+     * @param cone resulting cone polygon (reuses storage of an earlier detection)
+     */
+    void transformSensorCone(const Position& origin, const Angle& heading, std::vector<Position>& cone) const;
+
+    /**
+     * Get handle of the object carrying this sensor
+     * @return ego object handle or NoObjectHandle, e.g. for road side units
+     */
+    ObjectHandle getEgoHandle() const;
+
     SensorConfigFov mFovConfig;
     Updatable<SensorDetection> mLastDetection;
     bool mDrawLinesOfSight;
 
 private:
+    omnetpp::SimTime mMeasurementInterval; /*< zero for measurement at each refresh */
+    omnetpp::SimTime mNextMeasurement;
+
+    // ego object is added to global environment model after sensor initialization
+    mutable ObjectHandle mEgoHandle = NoObjectHandle;
+
+    // sensor cone at origin with heading 0, validated at initialization
+    std::vector<Position> mSensorConeTemplate;
+
+    // buffers reused across measurements, only accessed by getPreselectionArea, detectObjects and applyDetection
+    mutable std::vector<Position> mSensorConeBuffer;
+    mutable LineOfSightCheck mLineOfSight;
+
     omnetpp::cFigure::Color mColor;
     omnetpp::cGroupFigure* mGroupFigure;
     omnetpp::cPolygonFigure* mSensorConeFigure;
     omnetpp::cGroupFigure* mLinesOfSightFigure;
     omnetpp::cGroupFigure* mObjectsFigure;
     omnetpp::cGroupFigure* mObstaclesFigure;
+    mutable FigurePool<omnetpp::cLineFigure> mLineOfSightPool;
+    mutable FigurePool<omnetpp::cPolygonFigure> mObstaclePool;
+    mutable FigurePool<omnetpp::cPolygonFigure> mObjectPool;
 };
 
 } // namespace artery
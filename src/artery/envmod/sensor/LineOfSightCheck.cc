@@ -0,0 +1,152 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/LineOfSightCheck.h"
+#include <boost/geometry/geometries/register/linestring.hpp>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <unordered_set>
+
+using LineOfSight = std::array<artery::Position, 2>;
+BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
+
+namespace artery
+{
+
+LineOfSightCheck::LineOfSightCheck(LineOfSightMethod method, LineOfSightKernelType kernel) :
+    mMethod(method), mKernel(kernel)
+{
+}
+
+void LineOfSightCheck::detect(SensorDetection& detection, const Objects& objects, const Obstacles& obstacles, bool allVisiblePoints)
+{
+    namespace bg = boost::geometry;
+    std::unordered_set<std::shared_ptr<EnvironmentModelObstacle>> blockingObstacles;
+    const bool sweep = mMethod == LineOfSightMethod::Sweep;
+
+    if (sweep) {
+        // separate sweeps find obstacles hidden behind a nearer object, too
+        mObjectVisibility.clear();
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            mObjectVisibility.addPolygon(objects[i]->getOutline(), i);
+        }
+        mObjectVisibility.compute(detection.sensorOrigin);
+        mObstacleVisibility.clear();
+        for (std::size_t i = 0; i < obstacles.size(); ++i) {
+            mObstacleVisibility.addPolygon(obstacles[i]->getOutline(), i);
+        }
+        mObstacleVisibility.compute(detection.sensorOrigin);
+    } else if (mKernel != LineOfSightKernelType::Boost) {
+        mObjectEdges.clear();
+        for (const auto& object : objects) {
+            mObjectEdges.addPolygon(object->getOutline());
+        }
+        mObstacleEdges.clear();
+        for (const auto& obstacle : obstacles) {
+            mObstacleEdges.addPolygon(obstacle->getOutline());
+        }
+    }
+
+    // check if objects in sensor cone are hidden by another object or an obstacle
+    for (const auto& object : objects)
+    {
+        for (const auto& objectPoint : object->getOutline())
+        {
+            // skip objects points outside of sensor cone
+            if (!bg::covered_by(objectPoint, detection.sensorCone)) {
+                continue;
+            }
+
+            bool noVehicleOccultation = true;
+            bool noObstacleOccultation = true;
+
+            if (sweep) {
+                int occluder = VisibilityPolygon::NoOccluder;
+                noVehicleOccultation = mObjectVisibility.isVisible(objectPoint, occluder);
+                if (!mObstacleVisibility.isVisible(objectPoint, occluder)) {
+                    blockingObstacles.insert(obstacles[occluder]);
+                    noObstacleOccultation = false;
+                }
+            } else {
+                for (std::size_t i = 0; i < objects.size(); ++i) {
+                    if (isOccludedByObject(*objects[i], i, detection.sensorOrigin, objectPoint)) {
+                        noVehicleOccultation = false;
+                        break;
+                    }
+                }
+
+                for (std::size_t i = 0; i < obstacles.size(); ++i) {
+                    assert(obstacles[i]);
+                    if (isOccludedByObstacle(*obstacles[i], i, detection.sensorOrigin, objectPoint)) {
+                        blockingObstacles.insert(obstacles[i]);
+                        noObstacleOccultation = false;
+                        break;
+                    }
+                }
+            }
+
+            if (noVehicleOccultation && noObstacleOccultation) {
+                if (detection.objects.empty() || detection.objects.back() != object) {
+                    detection.objects.push_back(object);
+                }
+
+                if (allVisiblePoints) {
+                    detection.visiblePoints.push_back(objectPoint);
+                } else {
+                    // no need to check other object points in detail except for visualization
+                    break;
+                }
+            }
+        } // for each (corner) point of object polygon
+    } // for each object
+
+    detection.obstacles.assign(blockingObstacles.begin(), blockingObstacles.end());
+}
+
+bool LineOfSightCheck::isOccludedByObject(const EnvironmentModelObject& object, std::size_t index,
+        const Position& origin, const Position& target) const
+{
+    namespace bg = boost::geometry;
+    const LineOfSight lineOfSight { origin, target };
+
+    switch (mKernel) {
+        case LineOfSightKernelType::Edges:
+            return mObjectEdges.crosses(index, origin, target);
+        case LineOfSightKernelType::Boost:
+            return bg::crosses(lineOfSight, object.getOutline());
+        default: {
+            const bool occluded = mObjectEdges.crosses(index, origin, target);
+            if (occluded != bg::crosses(lineOfSight, object.getOutline())) {
+                throw std::runtime_error("line of sight kernels disagree on occlusion by object " + object.getExternalId());
+            }
+            return occluded;
+        }
+    }
+}
+
+bool LineOfSightCheck::isOccludedByObstacle(const EnvironmentModelObstacle& obstacle, std::size_t index,
+        const Position& origin, const Position& target) const
+{
+    namespace bg = boost::geometry;
+    const LineOfSight lineOfSight { origin, target };
+
+    switch (mKernel) {
+        case LineOfSightKernelType::Edges:
+            return mObstacleEdges.intersects(index, origin, target);
+        case LineOfSightKernelType::Boost:
+            return bg::intersects(lineOfSight, obstacle.getOutline());
+        default: {
+            const bool occluded = mObstacleEdges.intersects(index, origin, target);
+            if (occluded != bg::intersects(lineOfSight, obstacle.getOutline())) {
+                throw std::runtime_error("line of sight kernels disagree on occlusion by obstacle " + obstacle.getObstacleId());
+            }
+            return occluded;
+        }
+    }
+}
+
+} // namespace artery
@@ -0,0 +1,60 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_LINEOFSIGHTCHECK_H_SSC5IE4H
+#define ENVMOD_LINEOFSIGHTCHECK_H_SSC5IE4H
+
+#include "artery/envmod/sensor/LineOfSightKernel.h"
+#include "artery/envmod/sensor/SensorConfiguration.h"
+#include "artery/envmod/sensor/SensorDetection.h"
+#include "artery/envmod/sensor/VisibilityPolygon.h"
+#include <memory>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * LineOfSightCheck finds the preselected objects visible from a sensor's origin
+ *
+ * An object is visible if any of its outline points within the sensor cone is neither
+ * hidden by another object nor by an obstacle. Obstacles hiding any such point are reported
+ * as blocking, even if a nearer object hides the point as well. Buffers are kept across checks,
+ * i.e. a LineOfSightCheck must not be shared by concurrent measurements.
+ */
+class LineOfSightCheck
+{
+public:
+    using Objects = std::vector<std::shared_ptr<EnvironmentModelObject>>;
+    using Obstacles = std::vector<std::shared_ptr<EnvironmentModelObstacle>>;
+
+    LineOfSightCheck() = default;
+    LineOfSightCheck(LineOfSightMethod, LineOfSightKernelType);
+
+    /**
+     * Add visible objects and their blocking obstacles to a detection
+     * @param detection detection with sensor origin and cone set
+     * @param objects preselected objects
+     * @param obstacles preselected obstacles
+     * @param allVisiblePoints collect all visible points instead of stopping at the first one per object
+     */
+    void detect(SensorDetection& detection, const Objects& objects, const Obstacles& obstacles, bool allVisiblePoints);
+
+private:
+    bool isOccludedByObject(const EnvironmentModelObject&, std::size_t index, const Position&, const Position&) const;
+    bool isOccludedByObstacle(const EnvironmentModelObstacle&, std::size_t index, const Position&, const Position&) const;
+
+    LineOfSightMethod mMethod = LineOfSightMethod::Rays;
+    LineOfSightKernelType mKernel = LineOfSightKernelType::Edges;
+    LineOfSightKernel mObjectEdges;
+    LineOfSightKernel mObstacleEdges;
+    VisibilityPolygon mObjectVisibility;
+    VisibilityPolygon mObstacleVisibility;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_LINEOFSIGHTCHECK_H_SSC5IE4H */
@@ -0,0 +1,212 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/LineOfSightKernel.h"
+#include <boost/geometry/geometries/register/linestring.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using LineOfSight = std::array<artery::Position, 2>;
+BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
+
+namespace artery
+{
+
+namespace
+{
+
+// number of edges processed between early exit checks
+constexpr std::size_t EdgeBlock = 8;
+
+// orientations below this fraction of the squared extent are considered degenerate
+constexpr double Uncertainty = 1e-12;
+
+inline double orientation(double px, double py, double qx, double qy, double rx, double ry)
+{
+    return (qx - px) * (ry - py) - (qy - py) * (rx - px);
+}
+
+} // namespace
+
+void LineOfSightKernel::clear()
+{
+    mX0.clear();
+    mY0.clear();
+    mX1.clear();
+    mY1.clear();
+    mMinX.clear();
+    mMinY.clear();
+    mMaxX.clear();
+    mMaxY.clear();
+    mOffsets.resize(1);
+}
+
+std::size_t LineOfSightKernel::addPolygon(const std::vector<Position>& outline)
+{
+    const std::size_t n = outline.size();
+    double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double x = outline[i].x.value();
+        const double y = outline[i].y.value();
+        const Position& next = outline[(i + 1) % n];
+        mX0.push_back(x);
+        mY0.push_back(y);
+        mX1.push_back(next.x.value());
+        mY1.push_back(next.y.value());
+
+        if (i == 0) {
+            minX = maxX = x;
+            minY = maxY = y;
+        } else {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+        }
+    }
+
+    mMinX.push_back(minX);
+    mMinY.push_back(minY);
+    mMaxX.push_back(maxX);
+    mMaxY.push_back(maxY);
+    mOffsets.push_back(mX0.size());
+    return size() - 1;
+}
+
+bool LineOfSightKernel::intersects(std::size_t polygon, const Position& a, const Position& b) const
+{
+    const Segment s = makeSegment(polygon, a, b);
+    if (!overlapsBoundingBox(polygon, s)) {
+        return false;
+    }
+
+    const std::size_t begin = mOffsets[polygon];
+    const std::size_t end = mOffsets[polygon + 1];
+    switch (findCrossing(begin, end, s)) {
+        case Crossing::Proper:
+            return true;
+        case Crossing::None:
+            // segment is either completely inside or outside
+            switch (locate(begin, end, s)) {
+                case Location::Inside:
+                    return true;
+                case Location::Outside:
+                    return false;
+                default:
+                    return boost::geometry::intersects(LineOfSight { a, b }, restorePolygon(polygon));
+            }
+        default:
+            return boost::geometry::intersects(LineOfSight { a, b }, restorePolygon(polygon));
+    }
+}
+
+bool LineOfSightKernel::crosses(std::size_t polygon, const Position& a, const Position& b) const
+{
+    const Segment s = makeSegment(polygon, a, b);
+    if (!overlapsBoundingBox(polygon, s)) {
+        return false;
+    }
+
+    const std::size_t begin = mOffsets[polygon];
+    const std::size_t end = mOffsets[polygon + 1];
+    switch (findCrossing(begin, end, s)) {
+        case Crossing::Proper:
+            // segment enters the interior and leaves it at a boundary point which is not a vertex
+            return true;
+        case Crossing::None:
+            // segment is either completely inside or outside
+            return false;
+        default:
+            return boost::geometry::crosses(LineOfSight { a, b }, restorePolygon(polygon));
+    }
+}
+
+LineOfSightKernel::Segment LineOfSightKernel::makeSegment(std::size_t polygon, const Position& a, const Position& b) const
+{
+    Segment s;
+    s.ax = a.x.value();
+    s.ay = a.y.value();
+    s.bx = b.x.value();
+    s.by = b.y.value();
+
+    // extent of all involved coordinates bounds the magnitude of orientations
+    const double extent = std::max({
+        std::max({ s.ax, s.bx, mMaxX[polygon] }) - std::min({ s.ax, s.bx, mMinX[polygon] }),
+        std::max({ s.ay, s.by, mMaxY[polygon] }) - std::min({ s.ay, s.by, mMinY[polygon] }),
+        1.0 });
+    s.tolerance = Uncertainty * extent * extent;
+    return s;
+}
+
+bool LineOfSightKernel::overlapsBoundingBox(std::size_t polygon, const Segment& s) const
+{
+    return std::max(s.ax, s.bx) >= mMinX[polygon] && std::min(s.ax, s.bx) <= mMaxX[polygon] &&
+        std::max(s.ay, s.by) >= mMinY[polygon] && std::min(s.ay, s.by) <= mMaxY[polygon];
+}
+
+LineOfSightKernel::Crossing LineOfSightKernel::findCrossing(std::size_t begin, std::size_t end, const Segment& s) const
+{
+    const double* x0 = mX0.data();
+    const double* y0 = mY0.data();
+    const double* x1 = mX1.data();
+    const double* y1 = mY1.data();
+
+    bool uncertain = false;
+    for (std::size_t block = begin; block < end; block += EdgeBlock) {
+        const std::size_t blockEnd = std::min(end, block + EdgeBlock);
+        bool crossing = false;
+        for (std::size_t i = block; i < blockEnd; ++i) {
+            const double d1 = orientation(s.ax, s.ay, s.bx, s.by, x0[i], y0[i]);
+            const double d2 = orientation(s.ax, s.ay, s.bx, s.by, x1[i], y1[i]);
+            const double d3 = orientation(x0[i], y0[i], x1[i], y1[i], s.ax, s.ay);
+            const double d4 = orientation(x0[i], y0[i], x1[i], y1[i], s.bx, s.by);
+            const bool separated = d1 * d2 > 0.0 || d3 * d4 > 0.0;
+            crossing |= d1 * d2 < 0.0 && d3 * d4 < 0.0 &&
+                std::min({ std::abs(d1), std::abs(d2), std::abs(d3), std::abs(d4) }) > s.tolerance;
+            // touching or collinear edges are degenerate unless clearly separated
+            uncertain |= !separated || std::min(std::abs(d1), std::abs(d2)) <= s.tolerance ||
+                std::min(std::abs(d3), std::abs(d4)) <= s.tolerance;
+        }
+
+        if (crossing) {
+            return Crossing::Proper;
+        }
+    }
+
+    return uncertain ? Crossing::Degenerate : Crossing::None;
+}
+
+LineOfSightKernel::Location LineOfSightKernel::locate(std::size_t begin, std::size_t end, const Segment& s) const
+{
+    // even-odd rule by horizontal ray casting from segment start
+    unsigned crossings = 0;
+    bool uncertain = false;
+    for (std::size_t i = begin; i < end; ++i) {
+        if ((mY0[i] > s.ay) != (mY1[i] > s.ay)) {
+            const double d = orientation(mX0[i], mY0[i], mX1[i], mY1[i], s.ax, s.ay);
+            // point is left of upwards edges and right of downwards edges if edge is right of point
+            crossings += (mY1[i] > mY0[i]) == (d > 0.0);
+            uncertain |= std::abs(d) <= s.tolerance;
+        }
+    }
+
+    if (uncertain) {
+        return Location::Boundary;
+    }
+    return crossings % 2 == 1 ? Location::Inside : Location::Outside;
+}
+
+const std::vector<Position>& LineOfSightKernel::restorePolygon(std::size_t polygon) const
+{
+    mRing.clear();
+    for (std::size_t i = mOffsets[polygon]; i < mOffsets[polygon + 1]; ++i) {
+        mRing.emplace_back(mX0[i], mY0[i]);
+    }
+    return mRing;
+}
+
+} // namespace artery
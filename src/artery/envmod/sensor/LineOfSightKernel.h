@@ -0,0 +1,104 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_LINEOFSIGHTKERNEL_H_R6WNZ0QA
+#define ENVMOD_LINEOFSIGHTKERNEL_H_R6WNZ0QA
+
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * LineOfSightKernel tests line segments against a set of polygons.
+ *
+ * Polygon edges are kept in flat structure-of-arrays buffers, i.e. the inner
+ * loops are plain arithmetic on contiguous doubles which compilers vectorize.
+ * Edges are processed block-wise with an early exit after each block.
+ *
+ * Only clear-cut configurations are decided by the kernel itself. Degenerate ones,
+ * i.e. segments touching vertices, running along edges or passing within rounding
+ * errors of the boundary, are delegated to boost.geometry. Hence, results are
+ * the same as boost::geometry::intersects and boost::geometry::crosses (linestring vs. polygon).
+ */
+class LineOfSightKernel
+{
+public:
+    /**
+     * Remove all polygons but keep allocated buffers
+     */
+    void clear();
+
+    /**
+     * Add polygon to kernel
+     * \param outline open polygon ring
+     * \return index of polygon
+     */
+    std::size_t addPolygon(const std::vector<Position>& outline);
+
+    /**
+     * Get number of stored polygons
+     */
+    std::size_t size() const { return mOffsets.size() - 1; }
+
+    /**
+     * Check if segment touches or overlaps with polygon
+     * \param polygon index of polygon
+     * \param a segment start
+     * \param b segment end
+     * \return same as boost::geometry::intersects(segment, polygon)
+     */
+    bool intersects(std::size_t polygon, const Position& a, const Position& b) const;
+
+    /**
+     * Check if segment crosses polygon, i.e. runs partially through its interior
+     * \param polygon index of polygon
+     * \param a segment start
+     * \param b segment end
+     * \return same as boost::geometry::crosses(segment, polygon)
+     */
+    bool crosses(std::size_t polygon, const Position& a, const Position& b) const;
+
+private:
+    struct Segment
+    {
+        double ax, ay, bx, by;
+        double tolerance; /*< orientations up to this magnitude are degenerate */
+    };
+
+    enum class Crossing { None, Proper, Degenerate };
+    enum class Location { Inside, Outside, Boundary };
+
+    Segment makeSegment(std::size_t polygon, const Position& a, const Position& b) const;
+    bool overlapsBoundingBox(std::size_t polygon, const Segment&) const;
+    Crossing findCrossing(std::size_t begin, std::size_t end, const Segment&) const;
+    Location locate(std::size_t begin, std::size_t end, const Segment&) const;
+    const std::vector<Position>& restorePolygon(std::size_t polygon) const;
+
+    // edge buffers (structure of arrays)
+    std::vector<double> mX0;
+    std::vector<double> mY0;
+    std::vector<double> mX1;
+    std::vector<double> mY1;
+
+    // polygon bounding boxes
+    std::vector<double> mMinX;
+    std::vector<double> mMinY;
+    std::vector<double> mMaxX;
+    std::vector<double> mMaxY;
+
+    // polygon i owns edges [mOffsets[i], mOffsets[i+1])
+    std::vector<std::size_t> mOffsets = { 0 };
+
+    // scratch buffer for degenerate cases
+    mutable std::vector<Position> mRing;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_LINEOFSIGHTKERNEL_H_R6WNZ0QA */
@@ -22,7 +22,7 @@ SensorDetection RsuFovSensor::createSensorCone() const
 {
     SensorDetection detection;
     detection.sensorOrigin = getFacilities().get_const<PositionProvider>().getCartesianPosition();
-    detection.sensorCone = createSensorArc(mFovConfig, detection.sensorOrigin, mFovHeading);
+    transformSensorCone(detection.sensorOrigin, mFovHeading, detection.sensorCone);
     return detection;
 }
 
@@ -11,6 +11,7 @@
 #include "artery/envmod/sensor/FieldOfView.h"
 #include "artery/envmod/sensor/SensorPosition.h"
 #include "artery/envmod/sensor/SensorDetection.h"
+#include "artery/utility/Geometry.h"
 #include <omnetpp/csimplemodule.h>
 #include <string>
 
@@ -28,6 +29,42 @@ public:
     virtual const std::string getSensorName() const = 0;
     virtual void setSensorName(const std::string& name) = 0;
     virtual SensorDetection detectObjects() const = 0;
+
+    /**
+     * Check if measurement can be split into detectObjects() and applyDetection()
+     *
+     * Sensors returning true guarantee that detectObjects() only reads the global
+     * environment model, i.e. it may run concurrently with other sensors.
+     */
+    virtual bool hasDeferrableMeasurement() const { return false; }
+
+    /**
+     * Apply a detection computed beforehand by detectObjects()
+     *
+     * Completes a deferred measurement, only called if hasDeferrableMeasurement() is true.
+     */
+    virtual void applyDetection(SensorDetection&&) {}
+
+    /**
+     * Check if sensor shall be measured at given time
+     *
+     * Sensors are measured at each environment model refresh by default.
+     * A sensor returning true considers its measurement for the current interval as done,
+     * i.e. the caller has to measure it.
+     * \param now current simulation time
+     * \return true if measurement is due
+     */
+    virtual bool isMeasurementDue(const omnetpp::SimTime& now) { return true; }
+
+    /**
+     * Get area in which the upcoming measurement may preselect objects
+     *
+     * The global environment model updates objects within this area before the measurement
+     * if lazy object updates are enabled. Sensors not preselecting any objects return false.
+     * \param area bounding box of preselection area
+     * \return true if area has been set
+     */
+    virtual bool getPreselectionArea(geometry::Box& area) const { return false; }
 };
 
 } // namespace artery
@@ -4,6 +4,8 @@
 #include <boost/geometry/strategies/transform/matrix_transformers.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/units/cmath.hpp>
+#include <cmath>
+#include <stdexcept>
 
 namespace artery
 {
@@ -57,4 +59,45 @@ std::vector<Position> createSensorArc(const SensorConfigFov& config, const Envir
     return createSensorArc(config, sensorPos, egoObj.getHeading());
 }
 
+void transformSensorCone(const std::vector<Position>& coneTemplate, const Position& origin, const Angle& heading,
+        std::vector<Position>& cone)
+{
+    // clockwise rotation by heading as done by createSensorArc, followed by translation to origin
+    const double c = std::cos(heading.radian());
+    const double s = std::sin(heading.radian());
+    const double ox = origin.x.value();
+    const double oy = origin.y.value();
+
+    cone.resize(coneTemplate.size());
+    for (std::size_t i = 0; i < coneTemplate.size(); ++i) {
+        const double x = coneTemplate[i].x.value();
+        const double y = coneTemplate[i].y.value();
+        cone[i] = Position { c * x + s * y + ox, -s * x + c * y + oy };
+    }
+}
+
+LineOfSightKernelType determineLineOfSightKernel(const std::string& name)
+{
+    if (name == "edges") {
+        return LineOfSightKernelType::Edges;
+    } else if (name == "boost") {
+        return LineOfSightKernelType::Boost;
+    } else if (name == "validate") {
+        return LineOfSightKernelType::Validate;
+    } else {
+        throw std::runtime_error("Invalid line of sight kernel: " + name);
+    }
+}
+
+LineOfSightMethod determineLineOfSightMethod(const std::string& name)
+{
+    if (name == "rays") {
+        return LineOfSightMethod::Rays;
+    } else if (name == "sweep") {
+        return LineOfSightMethod::Sweep;
+    } else {
+        throw std::runtime_error("Invalid line of sight method: " + name);
+    }
+}
+
 } // namespace artery
@@ -24,12 +24,27 @@ struct SensorConfig
         std::string sensorName;
 };
 
+enum class LineOfSightKernelType
+{
+    Edges, /*< flat edge buffers, see LineOfSightKernel */
+    Boost, /*< generic boost.geometry algorithms */
+    Validate /*< both, any disagreement is reported as error */
+};
+
+enum class LineOfSightMethod
+{
+    Rays, /*< test a ray to each object point against all occluders */
+    Sweep /*< build visibility polygon by angular sweep, see VisibilityPolygon */
+};
+
 struct SensorConfigFov : public SensorConfig
 {
         FieldOfView fieldOfView;
         SensorPosition sensorPosition = SensorPosition::FRONT;
         unsigned numSegments = 0; /*< number of sensor cone segments (0 build a triangle) */
         bool doLineOfSightCheck = true; /*< false for simple "object in sensor cone" tests */
+        LineOfSightMethod lineOfSightMethod = LineOfSightMethod::Rays;
+        LineOfSightKernelType lineOfSightKernel = LineOfSightKernelType::Edges; /*< kernel used by Rays method */
 };
 
 
@@ -44,6 +59,36 @@ struct SensorConfigFov : public SensorConfig
 std::vector<Position> createSensorArc(const SensorConfigFov&, const Position&, const Angle&);
 std::vector<Position> createSensorArc(const SensorConfigFov&, const EnvironmentModelObject&);
 
+/**
+ * Place a sensor cone created at origin with heading 0 at another pose
+ *
+ * This is the rigid transformation done by createSensorArc without building the arc again.
+ * @param coneTemplate sensor cone at origin with heading 0
+ * @param origin sensor origin
+ * @param heading sensor carrier's heading
+ * @param cone resulting cone polygon, its storage is reused
+ */
+void transformSensorCone(const std::vector<Position>& coneTemplate, const Position& origin, const Angle& heading,
+        std::vector<Position>& cone);
+
+/**
+ * Determine line of sight kernel by its name
+ *
+ * \throws runtime exception if string matches no kernel
+ * \param name "edges", "boost" or "validate"
+ * \return kernel type
+ */
+LineOfSightKernelType determineLineOfSightKernel(const std::string& name);
+
+/**
+ * Determine line of sight method by its name
+ *
+ * \throws runtime exception if string matches no method
+ * \param name "rays" or "sweep"
+ * \return line of sight method
+ */
+LineOfSightMethod determineLineOfSightMethod(const std::string& name);
+
 } // namespace artery
 
 #endif /* SENSORCONFIGURATION_H_ */
@@ -0,0 +1,251 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/VisibilityPolygon.h"
+#include <boost/math/constants/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace artery
+{
+
+namespace
+{
+
+const double pi = boost::math::double_constants::pi;
+
+// relative tolerance for points lying on the nearest occluder
+const double tolerance = 1e-9;
+
+} // namespace
+
+constexpr int VisibilityPolygon::NoOccluder;
+
+void VisibilityPolygon::clear()
+{
+    mPoints.clear();
+    mRings.clear();
+    mRingOwners.clear();
+    mEdges.clear();
+    mIntervals.clear();
+}
+
+void VisibilityPolygon::addPolygon(const std::vector<Position>& outline, int owner)
+{
+    mPoints.insert(mPoints.end(), outline.begin(), outline.end());
+    mRings.push_back(mPoints.size());
+    mRingOwners.push_back(owner);
+}
+
+void VisibilityPolygon::compute(const Position& origin)
+{
+    mOrigin = origin;
+    mEdges.clear();
+    mIntervals.clear();
+
+    const double ox = origin.x.value();
+    const double oy = origin.y.value();
+    std::size_t begin = 0;
+    for (std::size_t ring = 0; ring < mRings.size(); ++ring) {
+        const std::size_t end = mRings[ring];
+        for (std::size_t i = begin; i < end; ++i) {
+            const Position& a = mPoints[i];
+            const Position& b = mPoints[i + 1 < end ? i + 1 : begin];
+            addEdge(a.x.value() - ox, a.y.value() - oy, b.x.value() - ox, b.y.value() - oy, mRingOwners[ring]);
+        }
+        begin = end;
+    }
+
+    // collect angular breakpoints
+    mBreakpoints.clear();
+    mBreakpoints.push_back(-pi);
+    mBreakpoints.push_back(pi);
+    for (const Edge& edge : mEdges) {
+        mBreakpoints.push_back(edge.startAngle);
+        mBreakpoints.push_back(edge.endAngle);
+    }
+    std::sort(mBreakpoints.begin(), mBreakpoints.end());
+    mBreakpoints.erase(std::unique(mBreakpoints.begin(), mBreakpoints.end()), mBreakpoints.end());
+
+    mStarts.resize(mEdges.size());
+    mEnds.resize(mEdges.size());
+    for (std::size_t i = 0; i < mStarts.size(); ++i) {
+        mStarts[i] = i;
+        mEnds[i] = i;
+    }
+    std::sort(mStarts.begin(), mStarts.end(), [this](std::size_t lhs, std::size_t rhs) {
+        return mEdges[lhs].startAngle < mEdges[rhs].startAngle;
+    });
+    std::sort(mEnds.begin(), mEnds.end(), [this](std::size_t lhs, std::size_t rhs) {
+        return mEdges[lhs].endAngle < mEdges[rhs].endAngle;
+    });
+
+    // sweep counter-clockwise from -pi to pi, active edges are kept in a binary heap
+    // ordered by their distance along the ray through the current interval's centre
+    mHeap.clear();
+    mHeapSlots.assign(mEdges.size(), 0);
+    auto nextStart = mStarts.begin();
+    auto nextEnd = mEnds.begin();
+    for (std::size_t k = 0; k + 1 < mBreakpoints.size(); ++k) {
+        const double lower = mBreakpoints[k];
+        const double upper = mBreakpoints[k + 1];
+        const double centre = 0.5 * (lower + upper);
+        mRayX = std::cos(centre);
+        mRayY = std::sin(centre);
+
+        while (nextEnd != mEnds.end() && mEdges[*nextEnd].endAngle <= lower) {
+            removeEdge(*nextEnd);
+            ++nextEnd;
+        }
+        while (nextStart != mStarts.end() && mEdges[*nextStart].startAngle <= lower) {
+            insertEdge(*nextStart);
+            ++nextStart;
+        }
+
+        // order of crossing edges may have changed since the previous interval
+        siftDown(0);
+
+        const int nearest = mHeap.empty() ? -1 : mHeap.front();
+        if (mIntervals.empty() || mIntervals.back().edge != nearest) {
+            mIntervals.push_back(Interval { lower, nearest });
+        }
+    }
+}
+
+void VisibilityPolygon::addEdge(double ax, double ay, double bx, double by, int owner)
+{
+    // orient edge counter-clockwise around origin, skip edges collinear with origin
+    const double cross = ax * by - ay * bx;
+    if (cross == 0.0) {
+        return;
+    } else if (cross < 0.0) {
+        std::swap(ax, bx);
+        std::swap(ay, by);
+    }
+
+    const double startAngle = std::atan2(ay, ax);
+    const double endAngle = std::atan2(by, bx);
+    // edges without angular extent never become nearest, they are skipped as well
+    if (startAngle < endAngle) {
+        mEdges.push_back(Edge { ax, ay, bx, by, startAngle, endAngle, owner });
+    } else if (startAngle > endAngle) {
+        // edge wraps around at +/- pi: split it at the negative x axis
+        const double t = ay / (ay - by);
+        const double x = ax + t * (bx - ax);
+        if (startAngle < pi) {
+            mEdges.push_back(Edge { ax, ay, x, 0.0, startAngle, pi, owner });
+        }
+        if (-pi < endAngle) {
+            mEdges.push_back(Edge { x, 0.0, bx, by, -pi, endAngle, owner });
+        }
+    }
+}
+
+double VisibilityPolygon::distance(const Edge& edge, double angle) const
+{
+    return distance(edge, std::cos(angle), std::sin(angle));
+}
+
+double VisibilityPolygon::distance(const Edge& edge, double dx, double dy) const
+{
+    // intersect ray from origin with edge's supporting line
+    const double ex = edge.bx - edge.ax;
+    const double ey = edge.by - edge.ay;
+    const double denominator = dx * ey - dy * ex;
+    if (denominator == 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return (edge.ax * ey - edge.ay * ex) / denominator;
+}
+
+bool VisibilityPolygon::isNearer(std::size_t lhs, std::size_t rhs) const
+{
+    return distance(mEdges[lhs], mRayX, mRayY) < distance(mEdges[rhs], mRayX, mRayY);
+}
+
+void VisibilityPolygon::insertEdge(std::size_t edge)
+{
+    mHeapSlots[edge] = mHeap.size();
+    mHeap.push_back(edge);
+    siftUp(mHeap.size() - 1);
+}
+
+void VisibilityPolygon::removeEdge(std::size_t edge)
+{
+    const std::size_t slot = mHeapSlots[edge];
+    const std::size_t last = mHeap.back();
+    mHeap.pop_back();
+    if (last != edge) {
+        mHeap[slot] = last;
+        mHeapSlots[last] = slot;
+        siftUp(slot);
+        siftDown(mHeapSlots[last]);
+    }
+}
+
+void VisibilityPolygon::siftUp(std::size_t slot)
+{
+    while (slot > 0) {
+        const std::size_t parent = (slot - 1) / 2;
+        if (!isNearer(mHeap[slot], mHeap[parent])) {
+            break;
+        }
+        swapSlots(slot, parent);
+        slot = parent;
+    }
+}
+
+void VisibilityPolygon::siftDown(std::size_t slot)
+{
+    const std::size_t size = mHeap.size();
+    while (2 * slot + 1 < size) {
+        std::size_t child = 2 * slot + 1;
+        if (child + 1 < size && isNearer(mHeap[child + 1], mHeap[child])) {
+            ++child;
+        }
+        if (!isNearer(mHeap[child], mHeap[slot])) {
+            break;
+        }
+        swapSlots(slot, child);
+        slot = child;
+    }
+}
+
+void VisibilityPolygon::swapSlots(std::size_t a, std::size_t b)
+{
+    std::swap(mHeap[a], mHeap[b]);
+    mHeapSlots[mHeap[a]] = a;
+    mHeapSlots[mHeap[b]] = b;
+}
+
+bool VisibilityPolygon::isVisible(const Position& point, int& occluder) const
+{
+    occluder = NoOccluder;
+    const double x = point.x.value() - mOrigin.x.value();
+    const double y = point.y.value() - mOrigin.y.value();
+    const double range = std::hypot(x, y);
+    if (range == 0.0 || mIntervals.empty()) {
+        return true;
+    }
+
+    const double angle = std::atan2(y, x);
+    auto interval = std::upper_bound(mIntervals.begin(), mIntervals.end(), angle,
+            [](double angle, const Interval& interval) { return angle < interval.startAngle; });
+    if (interval == mIntervals.begin() || (--interval)->edge < 0) {
+        return true;
+    }
+
+    const Edge& edge = mEdges[interval->edge];
+    if (range <= distance(edge, angle) * (1.0 + tolerance) + tolerance) {
+        return true;
+    } else {
+        occluder = edge.owner;
+        return false;
+    }
+}
+
+} // namespace artery
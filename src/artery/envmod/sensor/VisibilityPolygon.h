@@ -0,0 +1,107 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_VISIBILITYPOLYGON_H_HM5D1WZE
+#define ENVMOD_VISIBILITYPOLYGON_H_HM5D1WZE
+
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * VisibilityPolygon describes the area visible from an origin among polygonal occluders.
+ *
+ * It is built by an angular sweep over all occluder edges: edge end points are sorted
+ * by their angle around the origin and the nearest edge is determined for each angular
+ * interval between consecutive end points. Active edges are kept in a binary heap ordered
+ * by their distance along the ray through the interval's centre and are removed when the
+ * sweep passes their end point, i.e. the sweep costs O(n log n) for n edges. Visibility of a point is then answered by a binary search for
+ * its interval, i.e. classifying many points costs O(log n) each instead of testing a ray
+ * against every occluder.
+ *
+ * Edges are assumed not to cross each other. Crossing edges, e.g. of overlapping polygons,
+ * are tolerated: the heap's top is re-checked in every interval, but edges further down
+ * keep their order from insertion, i.e. the nearest edge may be missed behind a crossing.
+ */
+class VisibilityPolygon
+{
+public:
+    static constexpr int NoOccluder = -1;
+
+    /**
+     * Remove all occluders but keep allocated buffers
+     */
+    void clear();
+
+    /**
+     * Add polygon occluding the view
+     * \param outline polygon ring
+     * \param owner identifier reported by isVisible for this polygon's edges, must not be negative
+     */
+    void addPolygon(const std::vector<Position>& outline, int owner);
+
+    /**
+     * Compute visibility from given origin by angular sweep
+     * \param origin view point
+     */
+    void compute(const Position& origin);
+
+    /**
+     * Check if point is visible from origin
+     *
+     * Points on the nearest occluder's boundary, e.g. the corners facing the origin, are visible.
+     * \param point point to check
+     * \param occluder set to owner of nearest occluder if point is hidden, NoOccluder otherwise
+     * \return true if point is visible
+     */
+    bool isVisible(const Position& point, int& occluder) const;
+
+private:
+    struct Edge
+    {
+        // relative to origin
+        double ax, ay, bx, by;
+        double startAngle, endAngle;
+        int owner;
+    };
+
+    struct Interval
+    {
+        double startAngle;
+        int edge; /*< nearest edge in interval or negative */
+    };
+
+    void addEdge(double ax, double ay, double bx, double by, int owner);
+    double distance(const Edge&, double angle) const;
+    double distance(const Edge&, double dx, double dy) const;
+    bool isNearer(std::size_t lhs, std::size_t rhs) const;
+    void insertEdge(std::size_t);
+    void removeEdge(std::size_t);
+    void siftUp(std::size_t slot);
+    void siftDown(std::size_t slot);
+    void swapSlots(std::size_t, std::size_t);
+
+    Position mOrigin;
+    std::vector<Position> mPoints;
+    std::vector<std::size_t> mRings; /*< ring i ends before mPoints[mRings[i]] */
+    std::vector<int> mRingOwners;
+    std::vector<Edge> mEdges;
+    std::vector<Interval> mIntervals;
+    std::vector<double> mBreakpoints;
+    std::vector<std::size_t> mStarts;
+    std::vector<std::size_t> mEnds;
+    std::vector<std::size_t> mHeap; /*< active edges during sweep, nearest first */
+    std::vector<std::size_t> mHeapSlots; /*< position of each active edge in heap */
+    double mRayX = 0.0; /*< direction of ray through current interval's centre */
+    double mRayY = 0.0;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_VISIBILITYPOLYGON_H_HM5D1WZE */
@@ -33,6 +33,11 @@ void CollectivePerceptionMockMessage::setObjectContainers(const std::vector<Obje
     mObjectContainers = std::make_shared<std::vector<ObjectContainer>>(objs);
 }
 
+void CollectivePerceptionMockMessage::setObjectContainers(std::shared_ptr<const std::vector<ObjectContainer>> objs)
+{
+    mObjectContainers = std::move(objs);
+}
+
 omnetpp::cPacket* CollectivePerceptionMockMessage::dup() const
 {
     return new CollectivePerceptionMockMessage(*this);
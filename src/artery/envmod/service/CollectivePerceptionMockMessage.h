@@ -40,6 +40,7 @@ public:
     const std::vector<ObjectContainer>& getObjectContainers() const { return *mObjectContainers; }
     void setObjectContainers(std::vector<ObjectContainer>&& objs);
     void setObjectContainers(const std::vector<ObjectContainer>& objs);
+    void setObjectContainers(std::shared_ptr<const std::vector<ObjectContainer>> objs);
 
     void setSourceStation(int id) { mSourceStation = id; }
     int getSourceStation() const { return mSourceStation; }
@@ -25,6 +25,11 @@ omnetpp::simsignal_t camSentSignal = omnetpp::cComponent::registerSignal("CamSen
 omnetpp::simsignal_t cpmSentSignal = omnetpp::cComponent::registerSignal("CpmSent");
 omnetpp::simsignal_t cpmReceivedSignal = omnetpp::cComponent::registerSignal("CpmReceived");
 
+std::uint64_t makeContainerKey(int trackingId, int sensorId)
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(trackingId)) << 32 | static_cast<std::uint32_t>(sensorId);
+}
+
 } // namespace
 
 
@@ -43,7 +48,8 @@ void CollectivePerceptionMockService::initialize(int stage)
     if (stage == InitStages::Prepare) {
         ItsG5Service::initialize();
         mPositionProvider = &getFacilities().get_const<PositionProvider>();
-        mEnvironmentModel = &getFacilities().get_const<LocalEnvironmentModel>();
+        mEnvironmentModel = &getFacilities().get_mutable<LocalEnvironmentModel>();
+        mObjectContainers = std::make_shared<ObjectContainers>();
 
         mDccProfile = par("dccProfile");
         mLengthHeader = par("lengthHeader");
@@ -71,9 +77,16 @@ void CollectivePerceptionMockService::initialize(int stage)
                 mSensors.insert(sensor);
             }
         }
+        mEnvironmentModel->addListener(this);
     }
 }
 
+void CollectivePerceptionMockService::finish()
+{
+    mEnvironmentModel->removeListener(this);
+    ItsG5Service::finish();
+}
+
 void CollectivePerceptionMockService::handleMessage(omnetpp::cMessage* msg)
 {
     if (msg == mTrigger) {
@@ -131,32 +144,81 @@ void CollectivePerceptionMockService::generatePacket()
         mFovLast = omnetpp::simTime();
     }
 
-    std::vector<CollectivePerceptionMockMessage::ObjectContainer> objectContainers;
-    using TrackedObject = LocalEnvironmentModel::TrackedObject;
-    for (const TrackedObject& object : mEnvironmentModel->allObjects()) {
-        const LocalEnvironmentModel::Tracking& tracking = object.second;
-        if (tracking.expired()) {
-            // skip objects with lost tracking
-            continue;
-        }
-
-        for (const auto& sensor : tracking.sensors()) {
-            if (mSensors.find(sensor.first) != mSensors.end()) {
-                CollectivePerceptionMockMessage::ObjectContainer objectContainer;
-                objectContainer.object = object.first;
-                objectContainer.objectId = tracking.id();
-                objectContainer.sensorId = sensor.first->getId();
-                objectContainer.timeOfMeasurement = sensor.second.last();
-                objectContainers.emplace_back(std::move(objectContainer));
-            }
-        }
-    }
-    packet->addByteLength(mLengthObjectContainer * objectContainers.size());
-    packet->setObjectContainers(std::move(objectContainers));
+    // hand over current containers without copying, subsequent changes copy them on write
+    updateTimesOfMeasurement();
+    packet->addByteLength(mLengthObjectContainer * mObjectContainers->size());
+    packet->setObjectContainers(mObjectContainers);
     packet->setSourceStation(mHostId);
 
     emit(cpmSentSignal, packet);
     request(req, packet);
 }
 
+void CollectivePerceptionMockService::trackingStarted(const LocalEnvironmentModel::TrackedObject& object, const Sensor& sensor)
+{
+    auto detected = object.first.lock();
+    if (!detected || mSensors.find(&sensor) == mSensors.end()) {
+        return;
+    }
+
+    // time of measurement is filled in at generation, see updateTimesOfMeasurement
+    CollectivePerceptionMockMessage::ObjectContainer objectContainer;
+    objectContainer.object = object.first;
+    objectContainer.objectId = object.second.id();
+    objectContainer.sensorId = sensor.getId();
+
+    ObjectContainers& containers = getMutableObjectContainers();
+    mObjectContainerIndex.emplace(makeContainerKey(objectContainer.objectId, objectContainer.sensorId), containers.size());
+    mObjectContainerSources.push_back(ObjectContainerSource { detected->getHandle(), &sensor });
+    containers.emplace_back(std::move(objectContainer));
+}
+
+void CollectivePerceptionMockService::trackingLost(const LocalEnvironmentModel::TrackedObject& object, const Sensor& sensor)
+{
+    auto found = mObjectContainerIndex.find(makeContainerKey(object.second.id(), sensor.getId()));
+    if (found == mObjectContainerIndex.end()) {
+        return;
+    }
+
+    // move last container into gap to keep containers densely packed
+    ObjectContainers& containers = getMutableObjectContainers();
+    const std::size_t index = found->second;
+    const std::size_t last = containers.size() - 1;
+    mObjectContainerIndex.erase(found);
+    if (index != last) {
+        containers[index] = std::move(containers[last]);
+        mObjectContainerSources[index] = mObjectContainerSources[last];
+        mObjectContainerIndex[makeContainerKey(containers[index].objectId, containers[index].sensorId)] = index;
+    }
+    containers.pop_back();
+    mObjectContainerSources.pop_back();
+}
+
+void CollectivePerceptionMockService::updateTimesOfMeasurement()
+{
+    if (mObjectContainers->empty()) {
+        return;
+    }
+
+    // repeated detections are not notified, thus look up their last detection once per CPM
+    ObjectContainers& containers = getMutableObjectContainers();
+    for (std::size_t i = 0; i < containers.size(); ++i) {
+        const ObjectContainerSource& source = mObjectContainerSources[i];
+        const LocalEnvironmentModel::Tracking* tracking = mEnvironmentModel->getTracking(source.handle);
+        const LocalEnvironmentModel::TrackingTime* time = tracking ? tracking->time(source.sensor) : nullptr;
+        if (time) {
+            containers[i].timeOfMeasurement = time->last();
+        }
+    }
+}
+
+auto CollectivePerceptionMockService::getMutableObjectContainers() -> ObjectContainers&
+{
+    // containers shared with CPMs in flight must not change
+    if (mObjectContainers.use_count() > 1) {
+        mObjectContainers = std::make_shared<ObjectContainers>(*mObjectContainers);
+    }
+    return *mObjectContainers;
+}
+
 } // namespace artery
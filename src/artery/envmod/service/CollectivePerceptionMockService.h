@@ -10,13 +10,16 @@
 #include "artery/envmod/service/CollectivePerceptionMockMessage.h"
 #include "artery/application/ItsG5Service.h"
 #include "artery/networking/PositionProvider.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 namespace artery
 {
 
-class CollectivePerceptionMockService : public ItsG5Service
+class CollectivePerceptionMockService : public ItsG5Service, private LocalEnvironmentModel::Listener
 {
     public:
         virtual ~CollectivePerceptionMockService();
@@ -24,6 +27,7 @@ class CollectivePerceptionMockService : public ItsG5Service
     protected:
         int numInitStages() const override;
         void initialize(int stage) override;
+        void finish() override;
         void trigger() override;
         void handleMessage(omnetpp::cMessage*) override;
         void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, omnetpp::cObject*, omnetpp::cObject*) override;
@@ -31,9 +35,24 @@ class CollectivePerceptionMockService : public ItsG5Service
         void indicate(const vanetza::btp::DataIndication&, omnetpp::cPacket*) override;
 
     private:
+        using ObjectContainers = std::vector<CollectivePerceptionMockMessage::ObjectContainer>;
+
+        struct ObjectContainerSource
+        {
+            ObjectHandle handle;
+            const Sensor* sensor;
+        };
+
+        // LocalEnvironmentModel::Listener
+        void trackingStarted(const LocalEnvironmentModel::TrackedObject&, const Sensor&) override;
+        void trackingLost(const LocalEnvironmentModel::TrackedObject&, const Sensor&) override;
+
+        ObjectContainers& getMutableObjectContainers();
+        void updateTimesOfMeasurement();
+
         int mHostId = 0;
         const PositionProvider* mPositionProvider = nullptr;
-        const LocalEnvironmentModel* mEnvironmentModel = nullptr;
+        LocalEnvironmentModel* mEnvironmentModel = nullptr;
         omnetpp::cMessage* mTrigger = nullptr;
         bool mGenerateAfterCam;
         omnetpp::SimTime mCpmOffset;
@@ -42,6 +61,9 @@ class CollectivePerceptionMockService : public ItsG5Service
         omnetpp::SimTime mFovLast = omnetpp::SimTime::ZERO;
         std::vector<CollectivePerceptionMockMessage::FovContainer> mFovContainers;
         std::unordered_set<const Sensor*> mSensors;
+        std::shared_ptr<ObjectContainers> mObjectContainers; /*< maintained incrementally, shared with generated CPMs */
+        std::vector<ObjectContainerSource> mObjectContainerSources; /*< same order as mObjectContainers */
+        std::unordered_map<std::uint64_t, std::size_t> mObjectContainerIndex; /*< (tracking id, sensor id) to container index */
         unsigned mDccProfile = 0;
         unsigned mLengthHeader = 0;
         unsigned mLengthFovContainer = 0;
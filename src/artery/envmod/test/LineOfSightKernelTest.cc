@@ -0,0 +1,155 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+/**
+ * Compare LineOfSightKernel with boost::geometry::intersects and boost::geometry::crosses
+ *
+ * Random segments are tested against random simple polygons, once with coordinates in general
+ * position and several times on grids. The latter provoke degenerate configurations like segments
+ * touching vertices or running along polygon edges, decimal grids add rounding errors on top.
+ */
+
+#include "artery/envmod/sensor/LineOfSightKernel.h"
+#include "artery/utility/Geometry.h"
+#include <boost/geometry/geometries/register/linestring.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using LineOfSight = std::array<artery::Position, 2>;
+BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
+
+namespace
+{
+
+using artery::LineOfSightKernel;
+using artery::Position;
+using Coordinate = std::function<double(std::mt19937&)>;
+
+struct Result
+{
+    std::size_t pairs = 0;
+    std::size_t intersects = 0; /*< disagreements of intersects */
+    std::size_t crosses = 0; /*< disagreements of crosses */
+};
+
+std::ostream& operator<<(std::ostream& os, const Position& pos)
+{
+    return os << "(" << pos.x.value() << ", " << pos.y.value() << ")";
+}
+
+void report(const char* predicate, bool expected, const LineOfSight& segment, const std::vector<Position>& polygon)
+{
+    std::cerr << predicate << " mismatch (boost: " << expected << ") for segment "
+        << segment[0] << " - " << segment[1] << " and polygon";
+    for (const Position& point : polygon) {
+        std::cerr << " " << point;
+    }
+    std::cerr << "\n";
+}
+
+std::vector<Position> randomPolygon(std::mt19937& rng, const Coordinate& coordinate)
+{
+    namespace bg = boost::geometry;
+    std::uniform_int_distribution<int> vertices(3, 6);
+
+    std::vector<Position> polygon;
+    do {
+        polygon.clear();
+        if (rng() % 3 == 0) {
+            double x0 = coordinate(rng), x1 = coordinate(rng);
+            double y0 = coordinate(rng), y1 = coordinate(rng);
+            polygon = { Position(x0, y0), Position(x0, y1), Position(x1, y1), Position(x1, y0) };
+        } else {
+            for (int i = vertices(rng); i > 0; --i) {
+                polygon.emplace_back(coordinate(rng), coordinate(rng));
+            }
+        }
+        bg::correct(polygon);
+    } while (!bg::is_valid(polygon) || bg::intersects(polygon) || std::abs(bg::area(polygon)) < 1e-6);
+    return polygon;
+}
+
+Result compare(unsigned seed, std::size_t polygons, const Coordinate& coordinate)
+{
+    namespace bg = boost::geometry;
+    std::mt19937 rng(seed);
+    LineOfSightKernel kernel;
+    Result result;
+
+    for (std::size_t i = 0; i < polygons; ++i) {
+        const std::vector<Position> polygon = randomPolygon(rng, coordinate);
+        kernel.clear();
+        kernel.addPolygon(polygon);
+
+        for (unsigned j = 0; j < 10; ++j) {
+            const LineOfSight segment { Position(coordinate(rng), coordinate(rng)), Position(coordinate(rng), coordinate(rng)) };
+            if (segment[0] == segment[1]) {
+                continue;
+            }
+            ++result.pairs;
+
+            const bool intersects = bg::intersects(segment, polygon);
+            if (kernel.intersects(0, segment[0], segment[1]) != intersects) {
+                ++result.intersects;
+                report("intersects", intersects, segment, polygon);
+            }
+
+            const bool crosses = bg::crosses(segment, polygon);
+            if (kernel.crosses(0, segment[0], segment[1]) != crosses) {
+                ++result.crosses;
+                report("crosses", crosses, segment, polygon);
+            }
+        }
+    }
+
+    return result;
+}
+
+Coordinate grid(double offset, double spacing, int cells)
+{
+    return [=](std::mt19937& rng) {
+        std::uniform_int_distribution<int> cell(0, cells);
+        return offset + spacing * cell(rng);
+    };
+}
+
+} // namespace
+
+int main()
+{
+    struct Case
+    {
+        const char* name;
+        Coordinate coordinate;
+    };
+
+    const std::vector<Case> cases = {
+        { "general position", [](std::mt19937& rng) { return std::uniform_real_distribution<double>(-100.0, 100.0)(rng); } },
+        { "integer grid", grid(0.0, 1.0, 6) },
+        { "offset integer grid", grid(5000.0, 1.0, 6) },
+        { "quarter metre grid", grid(8.0, 0.25, 6) },
+        { "half metre grid", grid(1234.5, 0.5, 6) },
+        { "decimetre grid", grid(55.5, 0.1, 6) },
+        { "offset decimetre grid", grid(5000.3, 0.1, 6) },
+        { "centimetre grid", grid(20.02, 0.01, 6) }
+    };
+
+    bool success = true;
+    unsigned seed = 1;
+    for (const Case& test : cases) {
+        const Result result = compare(seed++, 20000, test.coordinate);
+        std::cout << test.name << ": " << result.pairs << " pairs, "
+            << result.intersects << " intersects and " << result.crosses << " crosses mismatches\n";
+        success &= result.intersects == 0 && result.crosses == 0;
+    }
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/DensityRaster.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace artery
+{
+namespace gemv2
+{
+
+constexpr unsigned DensityRaster::maxStrips;
+
+void DensityRaster::reset(double width, double height, double cellSize)
+{
+    if (cellSize <= 0.0) {
+        throw std::invalid_argument("cell size of density raster has to be positive");
+    }
+
+    mCellSize = cellSize;
+    mColumns = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(width / cellSize)));
+    mRows = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(height / cellSize)));
+    mTable.assign((mColumns + 1) * (mRows + 1), 0.0);
+}
+
+void DensityRaster::clear()
+{
+    std::fill(mTable.begin(), mTable.end(), 0.0);
+}
+
+void DensityRaster::add(const Position& pos, double weight)
+{
+    auto cell = [this](double coord, std::size_t cells) {
+        const double i = std::floor(coord / mCellSize);
+        return i < 0.0 ? 0 : std::min(static_cast<std::size_t>(i), cells - 1);
+    };
+
+    // cell (i, j) is stored at (i + 1, j + 1) before build()
+    mTable[index(cell(pos.x.value(), mColumns) + 1, cell(pos.y.value(), mRows) + 1)] += weight;
+}
+
+void DensityRaster::build()
+{
+    for (std::size_t row = 1; row <= mRows; ++row) {
+        double rowSum = 0.0;
+        for (std::size_t column = 1; column <= mColumns; ++column) {
+            rowSum += mTable[index(column, row)];
+            mTable[index(column, row)] = rowSum + mTable[index(column, row - 1)];
+        }
+    }
+}
+
+double DensityRaster::sumCells(std::size_t column0, std::size_t row0, std::size_t column1, std::size_t row1) const
+{
+    // inclusive cell ranges [column0, column1] x [row0, row1]
+    return mTable[index(column1 + 1, row1 + 1)] - mTable[index(column0, row1 + 1)]
+        - mTable[index(column1 + 1, row0)] + mTable[index(column0, row0)];
+}
+
+double DensityRaster::sumEllipse(const Position& a, const Position& b, double range) const
+{
+    const double ax = a.x.value();
+    const double ay = a.y.value();
+    const double bx = b.x.value();
+    const double by = b.y.value();
+    const double distance = std::hypot(bx - ax, by - ay);
+    if (empty() || distance > range) {
+        return 0.0;
+    }
+
+    // ellipse centre, semi-axes and orientation of major axis
+    const double cx = 0.5 * (ax + bx);
+    const double cy = 0.5 * (ay + by);
+    const double major = 0.5 * range;
+    const double minor = std::sqrt(std::max(0.0, major * major - 0.25 * distance * distance));
+    if (minor <= 0.0) {
+        return 0.0;
+    }
+    const double ux = distance > 0.0 ? (bx - ax) / distance : 1.0;
+    const double uy = distance > 0.0 ? (by - ay) / distance : 0.0;
+
+    // implicit ellipse equation relative to centre: alpha x² + 2 beta x y + gamma y² <= 1
+    const double major2 = major * major;
+    const double minor2 = minor * minor;
+    const double alpha = ux * ux / major2 + uy * uy / minor2;
+    const double beta = ux * uy / major2 - ux * uy / minor2;
+    const double gamma = uy * uy / major2 + ux * ux / minor2;
+    const double halfHeight = std::sqrt(major2 * uy * uy + minor2 * ux * ux);
+
+    // rows and columns whose cell centres are within [low, high]
+    auto firstCell = [this](double low) {
+        return static_cast<long>(std::ceil(low / mCellSize - 0.5));
+    };
+    auto lastCell = [this](double high) {
+        return static_cast<long>(std::floor(high / mCellSize - 0.5));
+    };
+
+    const long row0 = std::max(0L, firstCell(cy - halfHeight));
+    const long row1 = std::min(static_cast<long>(mRows) - 1, lastCell(cy + halfHeight));
+    if (row0 > row1) {
+        return 0.0;
+    }
+
+    const long rows = row1 - row0 + 1;
+    const long strips = std::min<long>(rows, maxStrips);
+    double sum = 0.0;
+    for (long strip = 0; strip < strips; ++strip) {
+        const long stripRow0 = row0 + strip * rows / strips;
+        const long stripRow1 = row0 + (strip + 1) * rows / strips - 1;
+        const double y = 0.5 * (stripRow0 + stripRow1 + 1) * mCellSize - cy;
+
+        // horizontal extent of ellipse at strip's centre line
+        const double discriminant = beta * beta * y * y - alpha * (gamma * y * y - 1.0);
+        if (discriminant < 0.0) {
+            continue;
+        }
+        const double root = std::sqrt(discriminant);
+        const long column0 = std::max(0L, firstCell(cx + (-beta * y - root) / alpha));
+        const long column1 = std::min(static_cast<long>(mColumns) - 1, lastCell(cx + (-beta * y + root) / alpha));
+        if (column0 <= column1) {
+            sum += sumCells(column0, stripRow0, column1, stripRow1);
+        }
+    }
+    return sum;
+}
+
+} // namespace gemv2
+} // namespace artery
@@ -0,0 +1,84 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_DENSITYRASTER_H_N4XKD7QP
+#define ARTERY_GEMV2_DENSITYRASTER_H_N4XKD7QP
+
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+namespace gemv2
+{
+
+/**
+ * DensityRaster accumulates weighted points in a regular grid of square cells.
+ *
+ * After build(), sums over cells are looked up via a summed-area table, i.e. each
+ * rectangular block of cells costs O(1) independent of the number of added points.
+ * Points are attributed to the cell containing them; points outside of the raster
+ * are attributed to the nearest border cell.
+ */
+class DensityRaster
+{
+public:
+    /**
+     * Reset raster dimensions, all cells become empty
+     * \param width extent along x axis [m], raster starts at origin
+     * \param height extent along y axis [m], raster starts at origin
+     * \param cellSize edge length of a cell [m]
+     */
+    void reset(double width, double height, double cellSize);
+
+    /**
+     * Empty all cells but keep dimensions
+     */
+    void clear();
+
+    /**
+     * Add weight at given position
+     * \param pos position
+     * \param weight weight, e.g. 1 for counting
+     */
+    void add(const Position& pos, double weight = 1.0);
+
+    /**
+     * Build summed-area table of all weights added since last clear
+     */
+    void build();
+
+    /**
+     * Sum weights of cells whose centre is within an ellipse
+     *
+     * The ellipse is approximated by at most maxStrips horizontal strips of cell rows.
+     * Each strip spans the ellipse's extent at the strip's centre line.
+     * \param a first focus
+     * \param b second focus
+     * \param range distance sum of ellipse points to foci, i.e. twice the semi-major axis
+     * \return sum of weights, 0 if foci are farther apart than range
+     */
+    double sumEllipse(const Position& a, const Position& b, double range) const;
+
+    bool empty() const { return mColumns == 0 || mRows == 0; }
+
+    static constexpr unsigned maxStrips = 16;
+
+private:
+    std::size_t index(std::size_t column, std::size_t row) const { return row * (mColumns + 1) + column; }
+    double sumCells(std::size_t column0, std::size_t row0, std::size_t column1, std::size_t row1) const;
+
+    double mCellSize = 0.0;
+    std::size_t mColumns = 0;
+    std::size_t mRows = 0;
+    std::vector<double> mTable; /*< (columns + 1) x (rows + 1), first row and column are zero */
+};
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_DENSITYRASTER_H_N4XKD7QP */
@@ -4,10 +4,22 @@
  * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
  */
 
+#include "artery/StaticNodeManager.h"
 #include "artery/inet/gemv2/LinkClassifier.h"
 #include "artery/inet/gemv2/ObstacleIndex.h"
 #include "artery/inet/gemv2/VehicleIndex.h"
+#include "artery/traci/PolygonCache.h"
+#include "artery/utility/Geometry.h"
+#include "artery/utility/WorkerPool.h"
+#include "traci/BasicNodeManager.h"
 #include <inet/common/ModuleAccess.h>
+#include <inet/mobility/contract/IMobility.h>
+#include <omnetpp/cconfiguration.h>
+#include <cmath>
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
 
 namespace artery
 {
@@ -16,16 +28,48 @@ namespace gemv2
 
 Define_Module(LinkClassifier)
 
+namespace
+{
+// road-side units are matched by their exact position, tolerate rounding errors only
+const double siteResolution = 0.001;
+} // namespace
+
 void LinkClassifier::initialize()
 {
     mObstacleIndex = inet::findModuleFromPar<ObstacleIndex>(par("obstacleIndexModule"), this);
     mFoliageIndex = inet::findModuleFromPar<ObstacleIndex>(par("foliageIndexModule"), this);
     mVehicleIndex = inet::findModuleFromPar<VehicleIndex>(par("vehicleIndexModule"), this);
 
+    mCacheResolution = par("cacheResolution");
+    if (mCacheResolution < 0.0) {
+        throw omnetpp::cRuntimeError("cacheResolution must not be negative");
+    } else if (mCacheResolution > 0.0) {
+        // vehicle geometries change only at TraCI node updates
+        omnetpp::cModule* traci = getModuleByPath(par("traciModule"));
+        if (traci) {
+            traci->subscribe(traci::BasicNodeManager::updateNodeSignal, this);
+        } else {
+            throw omnetpp::cRuntimeError("No TraCI module found for signal subscription");
+        }
+    }
+
+    mStaticRasterCellSize = par("staticRasterCellSize");
+    mStaticRasterRange = par("staticRasterRange");
+    mStaticRasterCacheFile = par("staticRasterCacheFile").stdstringValue();
+    if (mStaticRasterCellSize < 0.0) {
+        throw omnetpp::cRuntimeError("staticRasterCellSize must not be negative");
+    } else if (mStaticRasterCellSize > 0.0) {
+        getSystemModule()->subscribe(StaticNodeManager::addRoadSideUnitSignal, this);
+    }
+
     WATCH(mCountLOS);
     WATCH(mCountNLOSb);
     WATCH(mCountNLOSf);
     WATCH(mCountNLOSv);
+    WATCH(mCacheHits);
+    WATCH(mCacheMisses);
+    WATCH(mStaticRasterHits);
+    WATCH(mStaticRasterMisses);
 }
 
 void LinkClassifier::finish()
@@ -34,25 +78,300 @@ void LinkClassifier::finish()
     recordScalar("countNLOSb", mCountNLOSb);
     recordScalar("countNLOSf", mCountNLOSf);
     recordScalar("countNLOSv", mCountNLOSv);
+    recordScalar("cacheHits", mCacheHits);
+    recordScalar("cacheMisses", mCacheMisses);
+    recordScalar("staticRasterHits", mStaticRasterHits);
+    recordScalar("staticRasterMisses", mStaticRasterMisses);
+    mCache.clear();
+
+    if (mStaticRastersModified && !mStaticRasterCacheFile.empty()) {
+        const std::string runId = omnetpp::getEnvir()->getConfigEx()->getVariable(CFGVAR_RUNID);
+        if (!writeVisibilityCache(mStaticRasterCacheFile, "." + runId + ".tmp", createStaticRasterKey(), mStaticRasters)) {
+            EV_WARN << "writing visibility cache file " << mStaticRasterCacheFile << " failed\n";
+        }
+    }
+    mStaticRasters.clear();
+    mStaticSites.clear();
+}
+
+void LinkClassifier::receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t signal, unsigned long, omnetpp::cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traci::BasicNodeManager::updateNodeSignal) {
+        clearCache();
+    }
+}
+
+void LinkClassifier::clearCache()
+{
+    // buckets are kept, the number of links per step is rather stable
+    mCache.clear();
+}
+
+void LinkClassifier::receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t signal, const char*, omnetpp::cObject* obj)
+{
+    Enter_Method_Silent();
+    if (signal == StaticNodeManager::addRoadSideUnitSignal) {
+        // transmissions originate from any mobility of the unit, e.g. directional antennas
+        auto rsu = omnetpp::check_and_cast<omnetpp::cModule*>(obj);
+        for (omnetpp::cModule::SubmoduleIterator it(rsu); !it.end(); ++it) {
+            if (auto mobility = dynamic_cast<inet::IMobility*>(*it)) {
+                const inet::Coord pos = mobility->getCurrentPosition();
+                addStaticSite(Position { pos.x, pos.y });
+            }
+        }
+    }
 }
 
 LinkClass LinkClassifier::classifyLink(const Position& tx, const Position& rx) const
+{
+    LinkClass link = LinkClass::LOS;
+    if (mCacheResolution > 0.0) {
+        auto insertion = mCache.emplace(makeCacheKey(tx, rx), LinkClass::LOS);
+        if (insertion.second) {
+            insertion.first->second = classifyLinkUncached(tx, rx);
+            ++mCacheMisses;
+        } else {
+            ++mCacheHits;
+        }
+        link = insertion.first->second;
+    } else {
+        link = classifyLinkUncached(tx, rx);
+    }
+
+    countLink(link);
+    return link;
+}
+
+void LinkClassifier::classifyLinks(const std::vector<std::pair<Position, Position>>& links, std::vector<LinkClass>& classes, WorkerPool& pool) const
+{
+    classes.assign(links.size(), LinkClass::LOS);
+    mBatchMisses.clear();
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        if (mCacheResolution > 0.0) {
+            auto found = mCache.find(makeCacheKey(links[i].first, links[i].second));
+            if (found != mCache.end()) {
+                classes[i] = found->second;
+                ++mCacheHits;
+                countLink(classes[i]);
+                continue;
+            }
+        }
+        mBatchMisses.push_back(i);
+    }
+
+    // cache and rasters are only read while classifying in parallel
+    mBatchLookups.assign(mBatchMisses.size(), StaticLookup {});
+    pool.run(mBatchMisses.size(), [this, &links, &classes](std::size_t j) {
+        const std::size_t i = mBatchMisses[j];
+        classes[i] = classifyLinkUncached(links[i].first, links[i].second, &mBatchLookups[j]);
+    });
+
+    for (std::size_t j = 0; j < mBatchMisses.size(); ++j) {
+        const std::size_t i = mBatchMisses[j];
+        if (mCacheResolution > 0.0) {
+            // an earlier link of this batch may have the same key
+            auto insertion = mCache.emplace(makeCacheKey(links[i].first, links[i].second), classes[i]);
+            if (insertion.second) {
+                applyStaticLookup(mBatchLookups[j]);
+                ++mCacheMisses;
+            } else {
+                classes[i] = insertion.first->second;
+                ++mCacheHits;
+            }
+        } else {
+            applyStaticLookup(mBatchLookups[j]);
+        }
+        countLink(classes[i]);
+    }
+}
+
+void LinkClassifier::countLink(LinkClass link) const
+{
+    switch (link) {
+        case LinkClass::NLOSb:
+            ++mCountNLOSb;
+            break;
+        case LinkClass::NLOSf:
+            ++mCountNLOSf;
+            break;
+        case LinkClass::NLOSv:
+            ++mCountNLOSv;
+            break;
+        default:
+            ++mCountLOS;
+            break;
+    }
+}
+
+LinkClass LinkClassifier::classifyLinkUncached(const Position& tx, const Position& rx, StaticLookup* deferred) const
+{
+    LinkClass link = mStaticSites.empty() ? classifyStaticGeometry(tx, rx) : classifyStaticLink(tx, rx, deferred);
+    if (link == LinkClass::LOS && mVehicleIndex->anyBlockage(tx, rx)) {
+        link = LinkClass::NLOSv;
+    }
+    return link;
+}
+
+LinkClass LinkClassifier::classifyStaticLink(const Position& tx, const Position& rx, StaticLookup* deferred) const
+{
+    auto site = mStaticSites.find(makeSiteKey(tx));
+    const Position* other = &rx;
+    if (site == mStaticSites.end()) {
+        site = mStaticSites.find(makeSiteKey(rx));
+        other = &tx;
+    }
+
+    StaticLookup lookup;
+    if (site != mStaticSites.end()) {
+        lookup.raster = &mStaticRasters[site->second];
+        lookup.cell = lookup.raster->getCellIndex(*other);
+    }
+    if (lookup.cell == StaticVisibilityRaster::npos) {
+        return classifyStaticGeometry(tx, rx);
+    }
+
+    using Cell = StaticVisibilityRaster::Cell;
+    lookup.value = lookup.raster->getCell(lookup.cell);
+    if (lookup.value == Cell::Unknown) {
+        // all positions within a cell share the classification of the cell's centre
+        switch (classifyStaticGeometry(lookup.raster->getSite(), lookup.raster->getCellCentre(lookup.cell))) {
+            case LinkClass::NLOSb:
+                lookup.value = Cell::NLOSb;
+                break;
+            case LinkClass::NLOSf:
+                lookup.value = Cell::NLOSf;
+                break;
+            default:
+                lookup.value = Cell::LOS;
+                break;
+        }
+    }
+
+    if (deferred) {
+        *deferred = lookup;
+    } else {
+        applyStaticLookup(lookup);
+    }
+
+    switch (lookup.value) {
+        case Cell::NLOSb:
+            return LinkClass::NLOSb;
+        case Cell::NLOSf:
+            return LinkClass::NLOSf;
+        default:
+            return LinkClass::LOS;
+    }
+}
+
+void LinkClassifier::applyStaticLookup(const StaticLookup& lookup) const
+{
+    if (!lookup.raster) {
+        return;
+    } else if (lookup.raster->getCell(lookup.cell) == StaticVisibilityRaster::Cell::Unknown) {
+        lookup.raster->setCell(lookup.cell, lookup.value);
+        mStaticRastersModified = true;
+        ++mStaticRasterMisses;
+    } else {
+        ++mStaticRasterHits;
+    }
+}
+
+LinkClass LinkClassifier::classifyStaticGeometry(const Position& tx, const Position& rx) const
 {
     LinkClass link = LinkClass::LOS;
     if (mObstacleIndex->anyBlockage(tx, rx)) {
         link = LinkClass::NLOSb;
-        ++mCountNLOSb;
     } else if (mFoliageIndex->anyBlockage(tx, rx)) {
         link = LinkClass::NLOSf;
-        ++mCountNLOSf;
-    } else if (mVehicleIndex->anyBlockage(tx, rx)) {
-        link = LinkClass::NLOSv;
-        ++mCountNLOSv;
-    } else {
-        ++mCountLOS;
     }
     return link;
 }
 
+void LinkClassifier::addStaticSite(const Position& pos)
+{
+    // obstacles are indexed at TraCI initialization, i.e. before any road-side unit is added
+    loadStaticRasters();
+
+    const SiteKey key = makeSiteKey(pos);
+    if (mStaticSites.find(key) == mStaticSites.end()) {
+        mStaticSites.emplace(key, mStaticRasters.size());
+        mStaticRasters.emplace_back(pos, mStaticRasterRange, mStaticRasterCellSize);
+    }
+}
+
+void LinkClassifier::loadStaticRasters()
+{
+    if (mStaticRastersLoaded) {
+        return;
+    }
+
+    mStaticRastersLoaded = true;
+    if (!mStaticRasterCacheFile.empty()) {
+        const PolygonCacheKey key = createStaticRasterKey();
+        if (readVisibilityCache(mStaticRasterCacheFile, key, mStaticRasterRange, mStaticRasterCellSize, mStaticRasters)) {
+            EV_INFO << "visibility rasters loaded from cache file " << mStaticRasterCacheFile << "\n";
+            for (std::size_t i = 0; i < mStaticRasters.size(); ++i) {
+                mStaticSites.emplace(makeSiteKey(mStaticRasters[i].getSite()), i);
+            }
+        } else {
+            EV_INFO << "cache file " << mStaticRasterCacheFile << " is missing or outdated, visibility rasters start empty\n";
+        }
+    }
+}
+
+PolygonCacheKey LinkClassifier::createStaticRasterKey() const
+{
+    // rasters become outdated if any static geometry changes
+    PolygonCacheKey key;
+    key.add(mStaticRasterRange);
+    key.add(mStaticRasterCellSize);
+    for (const ObstacleIndex* index : { mObstacleIndex, mFoliageIndex }) {
+        const std::uint64_t count = index->getObstacles().size();
+        key.add(&count, sizeof(count));
+        for (const ObstacleIndex::Obstacle& obstacle : index->getObstacles()) {
+            const std::uint64_t points = obstacle.getOutline().size();
+            key.add(&points, sizeof(points));
+            for (const Position& point : obstacle.getOutline()) {
+                key.add(point.x.value());
+                key.add(point.y.value());
+            }
+        }
+    }
+    return key;
+}
+
+LinkClassifier::CacheKey LinkClassifier::makeCacheKey(const Position& tx, const Position& rx) const
+{
+    auto quantize = [this](const Position::value_type& coord) {
+        return static_cast<std::int64_t>(std::floor(coord.value() / mCacheResolution));
+    };
+
+    CacheKey key { quantize(tx.x), quantize(tx.y), quantize(rx.x), quantize(rx.y) };
+    // links are symmetric: order end points so both directions share one entry
+    if (std::tie(key.bx, key.by) < std::tie(key.ax, key.ay)) {
+        std::swap(key.ax, key.bx);
+        std::swap(key.ay, key.by);
+    }
+    return key;
+}
+
+LinkClassifier::SiteKey LinkClassifier::makeSiteKey(const Position& pos) const
+{
+    return SiteKey {
+        static_cast<std::int64_t>(std::round(pos.x.value() / siteResolution)),
+        static_cast<std::int64_t>(std::round(pos.y.value() / siteResolution))
+    };
+}
+
+std::size_t LinkClassifier::CacheKeyHash::operator()(const CacheKey& key) const
+{
+    std::size_t seed = 0;
+    for (std::int64_t value : { key.ax, key.ay, key.bx, key.by }) {
+        seed ^= std::hash<std::int64_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
 } // namespace gemv2
 } // namespace artery
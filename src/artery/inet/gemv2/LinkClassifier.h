@@ -8,13 +8,22 @@
 #define LINKCLASSIFIER_H_OAXCBN1T
 
 #include "LinkClass.h"
+#include "artery/inet/gemv2/StaticVisibilityRaster.h"
+#include <omnetpp/clistener.h>
 #include <omnetpp/csimplemodule.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace artery
 {
 
-// forward declaration
-class Position;
+// forward declarations
+class PolygonCacheKey;
+class WorkerPool;
 
 namespace gemv2
 {
@@ -23,14 +32,82 @@ namespace gemv2
 class ObstacleIndex;
 class VehicleIndex;
 
-class LinkClassifier : public omnetpp::cSimpleModule
+/**
+ * LinkClassifier determines the GEMV2 link class between two positions.
+ *
+ * Optionally, classified links are cached until the next TraCI node update, i.e. as long as
+ * vehicle geometries remain unchanged. Links are symmetric, thus a cached link
+ * serves both directions. Positions are quantized for cache lookups.
+ *
+ * Optionally, links of road-side units consult a StaticVisibilityRaster per unit
+ * for buildings and foliage, i.e. only vehicles are checked for each link then.
+ */
+class LinkClassifier : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
 public:
     void initialize() override;
     void finish() override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, unsigned long, omnetpp::cObject*) override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, const char*, omnetpp::cObject*) override;
     LinkClass classifyLink(const Position& tx, const Position& rx) const;
 
+    /**
+     * Classify several links at once
+     *
+     * Links missing in cache are classified in parallel. Cache, visibility rasters and
+     * statistics are updated afterwards as if the links were classified one after another.
+     * \param links pairs of transmitter and receiver positions
+     * \param classes link classes in order of links
+     * \param pool workers classifying links
+     */
+    void classifyLinks(const std::vector<std::pair<Position, Position>>& links, std::vector<LinkClass>& classes, WorkerPool& pool) const;
+
+    /**
+     * Drop cached links, necessary whenever vehicle geometries have changed
+     */
+    void clearCache();
+
 private:
+    struct CacheKey
+    {
+        std::int64_t ax, ay, bx, by;
+
+        bool operator==(const CacheKey& other) const
+        {
+            return ax == other.ax && ay == other.ay && bx == other.bx && by == other.by;
+        }
+    };
+
+    struct CacheKeyHash
+    {
+        std::size_t operator()(const CacheKey&) const;
+    };
+
+    using Cache = std::unordered_map<CacheKey, LinkClass, CacheKeyHash>;
+
+    using SiteKey = std::pair<std::int64_t, std::int64_t>;
+
+    /**
+     * Raster cell looked up for a link, cell is updated when the lookup is applied
+     */
+    struct StaticLookup
+    {
+        StaticVisibilityRaster* raster = nullptr;
+        std::size_t cell = StaticVisibilityRaster::npos;
+        StaticVisibilityRaster::Cell value = StaticVisibilityRaster::Cell::Unknown;
+    };
+
+    LinkClass classifyLinkUncached(const Position& tx, const Position& rx, StaticLookup* deferred = nullptr) const;
+    LinkClass classifyStaticLink(const Position& tx, const Position& rx, StaticLookup* deferred) const;
+    void applyStaticLookup(const StaticLookup&) const;
+    void countLink(LinkClass) const;
+    LinkClass classifyStaticGeometry(const Position& tx, const Position& rx) const;
+    CacheKey makeCacheKey(const Position& tx, const Position& rx) const;
+    SiteKey makeSiteKey(const Position&) const;
+    void addStaticSite(const Position&);
+    void loadStaticRasters();
+    PolygonCacheKey createStaticRasterKey() const;
+
     const ObstacleIndex* mObstacleIndex;
     const ObstacleIndex* mFoliageIndex;
     const VehicleIndex* mVehicleIndex;
@@ -39,6 +116,24 @@ private:
     mutable unsigned mCountNLOSb = 0;
     mutable unsigned mCountNLOSf = 0;
     mutable unsigned mCountNLOSv = 0;
+
+    double mCacheResolution = 0.0; /*< quantization of cached positions, 0 disables cache */
+    mutable Cache mCache;
+    mutable unsigned long mCacheHits = 0;
+    mutable unsigned long mCacheMisses = 0;
+
+    double mStaticRasterCellSize = 0.0; /*< cell size of visibility rasters, 0 disables rasters */
+    double mStaticRasterRange = 0.0;
+    std::string mStaticRasterCacheFile;
+    bool mStaticRastersLoaded = false;
+    mutable bool mStaticRastersModified = false;
+    mutable std::vector<StaticVisibilityRaster> mStaticRasters;
+    std::map<SiteKey, std::size_t> mStaticSites; /*< indices of mStaticRasters by site position */
+    mutable unsigned long mStaticRasterHits = 0;
+    mutable unsigned long mStaticRasterMisses = 0;
+
+    mutable std::vector<std::size_t> mBatchMisses; /*< indices of links missing in cache */
+    mutable std::vector<StaticLookup> mBatchLookups; /*< deferred raster lookups of missed links */
 };
 
 } // namespace gemv2
@@ -0,0 +1,31 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/LinkPathLoss.h"
+#include <inet/physicallayer/contract/packetlevel/IRadioMedium.h>
+#include <omnetpp/checkandcast.h>
+
+namespace artery
+{
+namespace gemv2
+{
+
+namespace phy = inet::physicallayer;
+
+inet::mps getPropagationSpeed(const phy::ITransmission* transmission)
+{
+    auto radioMedium = transmission->getTransmitter()->getMedium();
+    return radioMedium->getPropagation()->getPropagationSpeed();
+}
+
+inet::Hz getCarrierFrequency(const phy::ITransmission* transmission)
+{
+    auto narrowbandSignalAnalogModel = omnetpp::check_and_cast<const phy::INarrowbandSignal*>(transmission->getAnalogModel());
+    return narrowbandSignalAnalogModel->getCarrierFrequency();
+}
+
+} // namespace gemv2
+} // namespace artery
@@ -0,0 +1,48 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_LINKPATHLOSS_H_C4YJ0NPE
+#define ARTERY_GEMV2_LINKPATHLOSS_H_C4YJ0NPE
+
+#include <inet/common/Units.h>
+#include <inet/common/geometry/common/Coord.h>
+
+// forward declaration
+namespace inet { namespace physicallayer { class ITransmission; } }
+
+namespace artery
+{
+namespace gemv2
+{
+
+/**
+ * ILinkPathLoss is implemented by path loss models depending on link geometry only,
+ * i.e. their losses can be computed without transmission and arrival objects of a radio medium.
+ */
+class ILinkPathLoss
+{
+public:
+    virtual ~ILinkPathLoss() = default;
+
+    /**
+     * Compute path loss between two antenna positions
+     * \param tx transmitter position
+     * \param rx receiver position
+     * \param propagationSpeed propagation speed of signal
+     * \param carrierFrequency carrier frequency of signal
+     * \return loss factor
+     */
+    virtual double computeLinkPathLoss(const inet::Coord& tx, const inet::Coord& rx,
+            inet::mps propagationSpeed, inet::Hz carrierFrequency) const = 0;
+};
+
+inet::mps getPropagationSpeed(const inet::physicallayer::ITransmission*);
+inet::Hz getCarrierFrequency(const inet::physicallayer::ITransmission*);
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_LINKPATHLOSS_H_C4YJ0NPE */
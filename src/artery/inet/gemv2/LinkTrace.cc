@@ -0,0 +1,299 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/LinkTrace.h"
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace artery
+{
+namespace gemv2
+{
+
+namespace
+{
+
+const char traceMagic[8] = { 'A', 'R', 'T', 'T', 'R', 'C', '\0', '\0' };
+const std::uint32_t traceVersion = 1;
+
+struct TraceHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+};
+
+enum RecordTag : char
+{
+    NetworkTag = 'N',
+    ObstacleTag = 'O',
+    SnapshotTag = 'S',
+    VehicleTag = 'V',
+    LinkTag = 'L'
+};
+
+struct NetworkRecord
+{
+    double width;
+    double height;
+};
+
+struct SnapshotRecord
+{
+    double time;
+    std::uint64_t vehicles;
+};
+
+struct VehicleRecord
+{
+    double height;
+    double midpointX;
+    double midpointY;
+    std::uint32_t idLength;
+    std::uint32_t reserved;
+};
+
+struct LinkRecord
+{
+    double time;
+    double tx[3];
+    double rx[3];
+    double propagationSpeed;
+    double carrierFrequency;
+    double loss;
+    double sigma;
+    std::uint32_t snapshot;
+    std::uint32_t linkClass;
+};
+
+static_assert(sizeof(TraceHeader) == 16, "unexpected padding of trace header");
+static_assert(sizeof(NetworkRecord) == 16, "unexpected padding of network record");
+static_assert(sizeof(SnapshotRecord) == 16, "unexpected padding of snapshot record");
+static_assert(sizeof(VehicleRecord) == 32, "unexpected padding of vehicle record");
+static_assert(sizeof(LinkRecord) == 96, "unexpected padding of link record");
+
+// file layout: header, then records each preceded by its tag byte
+// obstacle records: layer byte, number of points (uint32) and points (x, y)
+// vehicle records: fixed part, id characters, number of points (uint32) and outline points (x, y)
+// vehicle records belong to the preceding snapshot record
+
+template<typename T>
+bool readValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool readOutline(std::istream& is, std::vector<Position>& outline)
+{
+    std::uint32_t points = 0;
+    if (!readValue(is, points)) {
+        return false;
+    }
+
+    outline.clear();
+    for (std::uint32_t i = 0; i < points; ++i) {
+        double xy[2];
+        if (!readValue(is, xy)) {
+            return false;
+        }
+        outline.emplace_back(xy[0], xy[1]);
+    }
+    return true;
+}
+
+} // namespace
+
+LinkTraceWriter::LinkTraceWriter(const std::string& path, const std::string& tmpSuffix) :
+    mPath(path), mTmpPath(path + tmpSuffix)
+{
+    mFile.open(mTmpPath, std::ios::binary | std::ios::trunc);
+    if (!mFile) {
+        throw std::runtime_error("cannot open link trace file " + mTmpPath);
+    }
+
+    TraceHeader header;
+    std::memcpy(header.magic, traceMagic, sizeof(traceMagic));
+    header.version = traceVersion;
+    header.reserved = 0;
+    mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+LinkTraceWriter::~LinkTraceWriter()
+{
+    if (mFile.is_open()) {
+        close();
+    }
+}
+
+void LinkTraceWriter::writeNetwork(double width, double height)
+{
+    const NetworkRecord record { width, height };
+    mFile.put(NetworkTag);
+    mFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void LinkTraceWriter::writeObstacle(LinkTrace::Layer layer, const std::vector<Position>& outline)
+{
+    mFile.put(ObstacleTag);
+    mFile.put(static_cast<char>(layer));
+    writeOutline(outline);
+}
+
+std::uint32_t LinkTraceWriter::writeSnapshot(double time, std::size_t vehicles)
+{
+    const SnapshotRecord record { time, vehicles };
+    mFile.put(SnapshotTag);
+    mFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    return mSnapshots++;
+}
+
+void LinkTraceWriter::writeVehicle(const std::string& id, double height, const Position& midpoint, const std::vector<Position>& outline)
+{
+    VehicleRecord record;
+    record.height = height;
+    record.midpointX = midpoint.x.value();
+    record.midpointY = midpoint.y.value();
+    record.idLength = id.size();
+    record.reserved = 0;
+    mFile.put(VehicleTag);
+    mFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    mFile.write(id.data(), id.size());
+    writeOutline(outline);
+}
+
+void LinkTraceWriter::writeLink(const LinkTrace::Link& link)
+{
+    const LinkRecord record {
+        link.time,
+        { link.tx.x, link.tx.y, link.tx.z },
+        { link.rx.x, link.rx.y, link.rx.z },
+        link.propagationSpeed, link.carrierFrequency, link.loss, link.sigma,
+        link.snapshot, static_cast<std::uint32_t>(link.linkClass)
+    };
+    mFile.put(LinkTag);
+    mFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void LinkTraceWriter::writeOutline(const std::vector<Position>& outline)
+{
+    const std::uint32_t points = outline.size();
+    mFile.write(reinterpret_cast<const char*>(&points), sizeof(points));
+    for (const Position& point : outline) {
+        const double xy[2] = { point.x.value(), point.y.value() };
+        mFile.write(reinterpret_cast<const char*>(xy), sizeof(xy));
+    }
+}
+
+bool LinkTraceWriter::close()
+{
+    mFile.close();
+    if (!mFile) {
+        std::remove(mTmpPath.c_str());
+        return false;
+    }
+
+    if (std::rename(mTmpPath.c_str(), mPath.c_str()) != 0) {
+        std::remove(mTmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool readLinkTrace(const std::string& path, LinkTrace& trace)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    TraceHeader header;
+    if (!readValue(file, header) ||
+        std::memcmp(header.magic, traceMagic, sizeof(traceMagic)) != 0 ||
+        header.version != traceVersion) {
+        return false;
+    }
+
+    LinkTrace result;
+    std::size_t pendingVehicles = 0;
+    char tag = 0;
+    while (file.get(tag)) {
+        if (tag == NetworkTag) {
+            NetworkRecord record;
+            if (!readValue(file, record)) {
+                return false;
+            }
+            result.netWidth = record.width;
+            result.netHeight = record.height;
+        } else if (tag == ObstacleTag) {
+            std::uint8_t layer = 0;
+            std::vector<Position> outline;
+            if (!readValue(file, layer) || !readOutline(file, outline)) {
+                return false;
+            }
+            if (layer == static_cast<std::uint8_t>(LinkTrace::Layer::Obstacles)) {
+                result.obstacles.push_back(std::move(outline));
+            } else if (layer == static_cast<std::uint8_t>(LinkTrace::Layer::Foliage)) {
+                result.foliage.push_back(std::move(outline));
+            } else {
+                return false;
+            }
+        } else if (tag == SnapshotTag) {
+            SnapshotRecord record;
+            if (pendingVehicles > 0 || !readValue(file, record) ||
+                result.snapshots.size() >= std::numeric_limits<std::uint32_t>::max()) {
+                return false;
+            }
+            result.snapshots.push_back(LinkTrace::Snapshot { record.time, {} });
+            pendingVehicles = record.vehicles;
+        } else if (tag == VehicleTag) {
+            VehicleRecord record;
+            if (pendingVehicles == 0 || !readValue(file, record)) {
+                return false;
+            }
+            LinkTrace::Vehicle vehicle;
+            vehicle.id.resize(record.idLength);
+            if (!file.read(&vehicle.id[0], record.idLength) || !readOutline(file, vehicle.outline)) {
+                return false;
+            }
+            vehicle.height = record.height;
+            vehicle.midpoint = Position { record.midpointX, record.midpointY };
+            result.snapshots.back().vehicles.push_back(std::move(vehicle));
+            --pendingVehicles;
+        } else if (tag == LinkTag) {
+            LinkRecord record;
+            if (pendingVehicles > 0 || !readValue(file, record) ||
+                record.snapshot >= result.snapshots.size() ||
+                record.linkClass > static_cast<std::uint32_t>(LinkClass::NLOSv)) {
+                return false;
+            }
+            LinkTrace::Link link;
+            link.time = record.time;
+            link.snapshot = record.snapshot;
+            link.tx = inet::Coord { record.tx[0], record.tx[1], record.tx[2] };
+            link.rx = inet::Coord { record.rx[0], record.rx[1], record.rx[2] };
+            link.propagationSpeed = record.propagationSpeed;
+            link.carrierFrequency = record.carrierFrequency;
+            link.linkClass = static_cast<LinkClass>(record.linkClass);
+            link.loss = record.loss;
+            link.sigma = record.sigma;
+            result.links.push_back(link);
+        } else {
+            return false;
+        }
+    }
+
+    if (pendingVehicles > 0) {
+        return false;
+    }
+
+    trace = std::move(result);
+    return true;
+}
+
+} // namespace gemv2
+} // namespace artery
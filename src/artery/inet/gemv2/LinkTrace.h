@@ -0,0 +1,127 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_LINKTRACE_H_Q7DLW3XS
+#define ARTERY_GEMV2_LINKTRACE_H_Q7DLW3XS
+
+#include "artery/inet/gemv2/LinkClass.h"
+#include "artery/utility/Geometry.h"
+#include <inet/common/geometry/common/Coord.h>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace artery
+{
+namespace gemv2
+{
+
+/**
+ * LinkTrace holds the link geometry recorded during a simulation run
+ *
+ * A trace consists of the static obstacles, snapshots of all vehicles per TraCI step
+ * and the links whose path loss has been computed. Each link refers to the vehicle snapshot
+ * valid at its time and keeps the results of the live run for later verification.
+ */
+struct LinkTrace
+{
+    enum class Layer : std::uint8_t { Obstacles, Foliage };
+
+    struct Vehicle
+    {
+        std::string id;
+        double height;
+        Position midpoint;
+        std::vector<Position> outline;
+    };
+
+    struct Snapshot
+    {
+        double time;
+        std::vector<Vehicle> vehicles;
+    };
+
+    struct Link
+    {
+        double time;
+        std::uint32_t snapshot; /*< index of vehicle snapshot */
+        inet::Coord tx;
+        inet::Coord rx;
+        double propagationSpeed; /*< [m/s] */
+        double carrierFrequency; /*< [Hz] */
+        LinkClass linkClass;
+        double loss; /*< path loss of link class' model, excluding small scale variation */
+        double sigma; /*< standard deviation of small scale variation [dB], NaN if disabled */
+    };
+
+    double netWidth = 0.0;
+    double netHeight = 0.0;
+    std::vector<std::vector<Position>> obstacles;
+    std::vector<std::vector<Position>> foliage;
+    std::vector<Snapshot> snapshots;
+    std::vector<Link> links;
+};
+
+/**
+ * LinkTraceWriter streams a LinkTrace to a binary file
+ *
+ * Records are written to a temporary file which is renamed when the writer is closed,
+ * i.e. incomplete traces of aborted runs never replace an existing trace.
+ */
+class LinkTraceWriter
+{
+public:
+    /**
+     * Open trace file for writing
+     * \param path trace file
+     * \param tmpSuffix suffix of temporary file, unique among concurrent writers
+     */
+    LinkTraceWriter(const std::string& path, const std::string& tmpSuffix);
+    LinkTraceWriter(const LinkTraceWriter&) = delete;
+    LinkTraceWriter& operator=(const LinkTraceWriter&) = delete;
+    ~LinkTraceWriter();
+
+    void writeNetwork(double width, double height);
+    void writeObstacle(LinkTrace::Layer, const std::vector<Position>& outline);
+
+    /**
+     * Start a new vehicle snapshot
+     * \param time simulation time of snapshot
+     * \param vehicles number of vehicles written subsequently by writeVehicle
+     * \return snapshot index referred to by links
+     */
+    std::uint32_t writeSnapshot(double time, std::size_t vehicles);
+    void writeVehicle(const std::string& id, double height, const Position& midpoint, const std::vector<Position>& outline);
+    void writeLink(const LinkTrace::Link&);
+
+    /**
+     * Finish trace file
+     * \return true if all records have been written successfully
+     */
+    bool close();
+
+private:
+    void writeOutline(const std::vector<Position>&);
+
+    std::string mPath;
+    std::string mTmpPath;
+    std::ofstream mFile;
+    std::uint32_t mSnapshots = 0;
+};
+
+/**
+ * Read a complete trace file
+ * \param path trace file
+ * \param trace destination, only modified on success
+ * \return true if trace file exists and is intact
+ */
+bool readLinkTrace(const std::string& path, LinkTrace& trace);
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_LINKTRACE_H_Q7DLW3XS */
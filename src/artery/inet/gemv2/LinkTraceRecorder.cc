@@ -0,0 +1,138 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/LinkPathLoss.h"
+#include "artery/inet/gemv2/LinkTraceRecorder.h"
+#include "artery/inet/gemv2/ObstacleIndex.h"
+#include "artery/inet/gemv2/VehicleIndex.h"
+#include "traci/API.h"
+#include "traci/BasicNodeManager.h"
+#include "traci/Boundary.h"
+#include "traci/Core.h"
+#include <inet/common/ModuleAccess.h>
+#include <inet/physicallayer/contract/packetlevel/ITransmission.h>
+#include <omnetpp/cconfiguration.h>
+#include <omnetpp/checkandcast.h>
+
+namespace artery
+{
+namespace gemv2
+{
+
+Define_Module(LinkTraceRecorder)
+
+namespace
+{
+const omnetpp::simsignal_t traciInitSignal = omnetpp::cComponent::registerSignal("traci.init");
+} // namespace
+
+void LinkTraceRecorder::initialize()
+{
+    mObstacleIndex = inet::findModuleFromPar<ObstacleIndex>(par("obstacleIndexModule"), this);
+    mFoliageIndex = inet::findModuleFromPar<ObstacleIndex>(par("foliageIndexModule"), this);
+    mVehicleIndex = inet::findModuleFromPar<VehicleIndex>(par("vehicleIndexModule"), this);
+
+    omnetpp::cModule* traci = getModuleByPath(par("traciModule"));
+    if (traci) {
+        traci->subscribe(traciInitSignal, this);
+        traci->subscribe(traci::BasicNodeManager::updateNodeSignal, this);
+    } else {
+        throw omnetpp::cRuntimeError("No TraCI module found for signal subscription");
+    }
+
+    const std::string traceFile = par("traceFile").stdstringValue();
+    const std::string runId = omnetpp::getEnvir()->getConfigEx()->getVariable(CFGVAR_RUNID);
+    mWriter.reset(new LinkTraceWriter(traceFile, "." + runId + ".tmp"));
+
+    WATCH(mRecordedLinks);
+    WATCH(mRecordedSnapshots);
+}
+
+void LinkTraceRecorder::finish()
+{
+    if (mWriter && !mWriter->close()) {
+        EV_WARN << "writing link trace file " << par("traceFile").stdstringValue() << " failed\n";
+    }
+    mWriter.reset();
+
+    recordScalar("recordedLinks", mRecordedLinks);
+    recordScalar("recordedSnapshots", mRecordedSnapshots);
+}
+
+void LinkTraceRecorder::receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t signal, unsigned long, omnetpp::cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traci::BasicNodeManager::updateNodeSignal) {
+        mSnapshotPending = true;
+    }
+}
+
+void LinkTraceRecorder::receiveSignal(omnetpp::cComponent* source, omnetpp::simsignal_t signal, const omnetpp::SimTime&, omnetpp::cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traciInitSignal) {
+        auto core = omnetpp::check_and_cast<traci::Core*>(source);
+        const traci::Boundary boundary { core->getAPI()->simulation.getNetBoundary() };
+        mNetWidth = boundary.upperRightPosition().x - boundary.lowerLeftPosition().x;
+        mNetHeight = boundary.upperRightPosition().y - boundary.lowerLeftPosition().y;
+    }
+}
+
+void LinkTraceRecorder::recordLink(const inet::physicallayer::ITransmission* transmission,
+        const inet::Coord& tx, const inet::Coord& rx, LinkClass link, double loss, double sigma)
+{
+    if (!mWriter) {
+        return;
+    }
+
+    if (!mStaticGeometryWritten) {
+        // obstacle indices are populated at TraCI initialisation, i.e. before any transmission
+        writeStaticGeometry();
+    }
+    if (mSnapshotPending) {
+        writeSnapshot();
+    }
+
+    LinkTrace::Link record;
+    record.time = omnetpp::simTime().dbl();
+    record.snapshot = mSnapshot;
+    record.tx = tx;
+    record.rx = rx;
+    record.propagationSpeed = getPropagationSpeed(transmission).get();
+    record.carrierFrequency = getCarrierFrequency(transmission).get();
+    record.linkClass = link;
+    record.loss = loss;
+    record.sigma = sigma;
+    mWriter->writeLink(record);
+    ++mRecordedLinks;
+}
+
+void LinkTraceRecorder::writeStaticGeometry()
+{
+    mWriter->writeNetwork(mNetWidth, mNetHeight);
+    for (const ObstacleIndex::Obstacle& obstacle : mObstacleIndex->getObstacles()) {
+        mWriter->writeObstacle(LinkTrace::Layer::Obstacles, obstacle.getOutline());
+    }
+    for (const ObstacleIndex::Obstacle& foliage : mFoliageIndex->getObstacles()) {
+        mWriter->writeObstacle(LinkTrace::Layer::Foliage, foliage.getOutline());
+    }
+    mStaticGeometryWritten = true;
+}
+
+void LinkTraceRecorder::writeSnapshot()
+{
+    const auto& vehicles = mVehicleIndex->getVehicles();
+    mSnapshot = mWriter->writeSnapshot(omnetpp::simTime().dbl(), vehicles.size());
+    for (const auto& vehicle : vehicles) {
+        mWriter->writeVehicle(vehicle.first, vehicle.second.getHeight(),
+                vehicle.second.getMidpoint(), vehicle.second.getOutline());
+    }
+    mSnapshotPending = false;
+    ++mRecordedSnapshots;
+}
+
+} // namespace gemv2
+} // namespace artery
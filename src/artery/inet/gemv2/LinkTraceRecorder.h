@@ -0,0 +1,77 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_LINKTRACERECORDER_H_5BZKHN0R
+#define ARTERY_GEMV2_LINKTRACERECORDER_H_5BZKHN0R
+
+#include "artery/inet/gemv2/LinkClass.h"
+#include "artery/inet/gemv2/LinkTrace.h"
+#include <inet/common/geometry/common/Coord.h>
+#include <omnetpp/clistener.h>
+#include <omnetpp/csimplemodule.h>
+#include <cstdint>
+#include <memory>
+
+// forward declaration
+namespace inet { namespace physicallayer { class ITransmission; } }
+
+namespace artery
+{
+namespace gemv2
+{
+
+// forward declarations
+class ObstacleIndex;
+class VehicleIndex;
+
+/**
+ * LinkTraceRecorder writes the geometry of all links evaluated by GEMV2 to a LinkTrace file.
+ *
+ * Static obstacles are written once, vehicles are written as a snapshot whenever they
+ * have changed since the last recorded link. Traces can be replayed by LinkTraceReplay
+ * without SUMO and INET's radio stack.
+ */
+class LinkTraceRecorder : public omnetpp::cSimpleModule, public omnetpp::cListener
+{
+public:
+    void initialize() override;
+    void finish() override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, unsigned long, omnetpp::cObject*) override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, const omnetpp::SimTime&, omnetpp::cObject*) override;
+
+    /**
+     * Record a link evaluated by GEMV2
+     * \param transmission signal's transmission
+     * \param tx transmitter position
+     * \param rx receiver position
+     * \param link link class
+     * \param loss path loss of link class' model, excluding small scale variation
+     * \param sigma standard deviation of small scale variation [dB], NaN if not applied
+     */
+    void recordLink(const inet::physicallayer::ITransmission* transmission, const inet::Coord& tx, const inet::Coord& rx,
+            LinkClass link, double loss, double sigma);
+
+private:
+    void writeStaticGeometry();
+    void writeSnapshot();
+
+    const ObstacleIndex* mObstacleIndex = nullptr;
+    const ObstacleIndex* mFoliageIndex = nullptr;
+    const VehicleIndex* mVehicleIndex = nullptr;
+    std::unique_ptr<LinkTraceWriter> mWriter;
+    double mNetWidth = 0.0;
+    double mNetHeight = 0.0;
+    bool mStaticGeometryWritten = false;
+    bool mSnapshotPending = true; /*< vehicles have changed since last snapshot */
+    std::uint32_t mSnapshot = 0; /*< index of last snapshot */
+    unsigned long mRecordedLinks = 0;
+    unsigned long mRecordedSnapshots = 0;
+};
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_LINKTRACERECORDER_H_5BZKHN0R */
@@ -0,0 +1,233 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/LinkClassifier.h"
+#include "artery/inet/gemv2/LinkPathLoss.h"
+#include "artery/inet/gemv2/LinkTraceReplay.h"
+#include "artery/inet/gemv2/ObstacleIndex.h"
+#include "artery/inet/gemv2/PathLoss.h"
+#include "artery/inet/gemv2/SmallScaleVariation.h"
+#include "artery/inet/gemv2/VehicleIndex.h"
+#include <inet/common/INETMath.h>
+#include <inet/common/ModuleAccess.h>
+#include <omnetpp/checkandcast.h>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace artery
+{
+namespace gemv2
+{
+
+Define_Module(LinkTraceReplay)
+
+namespace
+{
+
+// report only the first mismatching links in detail
+const unsigned long maxReportedMismatches = 10;
+
+const char* stageNames[] = {
+    "snapshots", "classifier", "LOS", "NLOSb", "NLOSf", "NLOSv", "smallScaleVariations"
+};
+
+bool identical(double a, double b)
+{
+    // compare bit patterns, i.e. NaNs are identical and 0.0 differs from -0.0
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+const char* getLinkClassName(LinkClass link)
+{
+    switch (link) {
+        case LinkClass::LOS:
+            return "LOS";
+        case LinkClass::NLOSb:
+            return "NLOSb";
+        case LinkClass::NLOSf:
+            return "NLOSf";
+        case LinkClass::NLOSv:
+            return "NLOSv";
+        default:
+            return "invalid";
+    }
+}
+
+} // namespace
+
+void LinkTraceReplay::initialize()
+{
+    mPathLoss = inet::findModuleFromPar<PathLoss>(par("pathLossModule"), this);
+    mClassifier = omnetpp::check_and_cast<LinkClassifier*>(mPathLoss->getSubmodule("classifier"));
+    mObstacleIndex = omnetpp::check_and_cast<ObstacleIndex*>(mPathLoss->getSubmodule("obstacles"));
+    mFoliageIndex = omnetpp::check_and_cast<ObstacleIndex*>(mPathLoss->getSubmodule("foliage"));
+    mVehicleIndex = omnetpp::check_and_cast<VehicleIndex*>(mPathLoss->getSubmodule("vehicles"));
+    mSmallScale = dynamic_cast<SmallScaleVariation*>(mPathLoss->getSubmodule("smallScaleVariations"));
+    mVerify = par("verify");
+
+    // replay after all modules have been initialized
+    scheduleAt(omnetpp::simTime(), new omnetpp::cMessage("replay"));
+}
+
+void LinkTraceReplay::handleMessage(omnetpp::cMessage* msg)
+{
+    delete msg;
+    replay();
+}
+
+void LinkTraceReplay::finish()
+{
+    static_assert(sizeof(stageNames) / sizeof(stageNames[0]) == NumStages, "name of each stage required");
+    for (std::size_t i = 0; i < NumStages; ++i) {
+        const std::string name = stageNames[i];
+        const Throughput& throughput = mThroughput[i];
+        const double seconds = std::chrono::duration<double>(throughput.time).count();
+        EV_INFO << name << ": " << throughput.count << " evaluations in " << seconds << " s";
+        if (seconds > 0.0) {
+            EV_INFO << " (" << throughput.count / seconds << " per second)";
+        }
+        EV_INFO << "\n";
+        recordScalar((name + "Evaluations").c_str(), throughput.count);
+        recordScalar((name + "Time").c_str(), seconds, "s");
+    }
+
+    EV_INFO << mReplayedLinks << " links replayed, " << mSkippedLinks << " links skipped\n";
+    recordScalar("replayedLinks", mReplayedLinks);
+    recordScalar("skippedLinks", mSkippedLinks);
+    if (mVerify) {
+        if (mMismatches > 0) {
+            EV_WARN << mMismatches << " replayed links differ from recorded links\n";
+        } else {
+            EV_INFO << "all replayed links are identical to recorded links\n";
+        }
+        recordScalar("mismatches", mMismatches);
+    }
+}
+
+void LinkTraceReplay::replay()
+{
+    const std::string traceFile = par("traceFile").stdstringValue();
+    LinkTrace trace;
+    if (!readLinkTrace(traceFile, trace)) {
+        throw omnetpp::cRuntimeError("cannot read link trace file %s", traceFile.c_str());
+    }
+    EV_INFO << "replaying " << trace.links.size() << " links of " << trace.snapshots.size() << " vehicle snapshots\n";
+
+    mNetWidth = trace.netWidth;
+    mNetHeight = trace.netHeight;
+    mObstacleIndex->replaceObstacles(std::move(trace.obstacles));
+    mFoliageIndex->replaceObstacles(std::move(trace.foliage));
+
+    bool loaded = false;
+    std::uint32_t snapshot = 0;
+    for (const LinkTrace::Link& link : trace.links) {
+        if (!loaded || link.snapshot != snapshot) {
+            snapshot = link.snapshot;
+            loadSnapshot(trace, snapshot);
+            loaded = true;
+        }
+        replayLink(link);
+    }
+}
+
+void LinkTraceReplay::loadSnapshot(const LinkTrace& trace, std::uint32_t snapshot)
+{
+    const Clock::time_point start = Clock::now();
+    std::map<std::string, VehicleIndex::Vehicle> vehicles;
+    for (const LinkTrace::Vehicle& vehicle : trace.snapshots.at(snapshot).vehicles) {
+        vehicles.emplace(vehicle.id, VehicleIndex::Vehicle { vehicle.outline, vehicle.midpoint, vehicle.height });
+    }
+
+    // same reactions as to a TraCI node update
+    mVehicleIndex->replaceVehicles(std::move(vehicles));
+    mClassifier->clearCache();
+    if (mSmallScale) {
+        mSmallScale->updateRasters(mNetWidth, mNetHeight);
+    }
+
+    Throughput& throughput = mThroughput[Snapshots];
+    throughput.time += Clock::now() - start;
+    ++throughput.count;
+}
+
+void LinkTraceReplay::replayLink(const LinkTrace::Link& link)
+{
+    const Position tx { link.tx.x, link.tx.y };
+    const Position rx { link.rx.x, link.rx.y };
+    auto measure = [this](Stage stage, Clock::time_point start) {
+        Throughput& throughput = mThroughput[stage];
+        throughput.time += Clock::now() - start;
+        ++throughput.count;
+    };
+
+    Clock::time_point start = Clock::now();
+    const LinkClass linkClass = mClassifier->classifyLink(tx, rx);
+    measure(Classifier, start);
+
+    inet::m range { 0.0 };
+    const inet::physicallayer::IPathLoss* model = mPathLoss->selectModel(linkClass, range);
+    double loss = 0.0;
+    double sigma = NaN;
+    if (link.tx.distance(link.rx) <= range.get()) {
+        auto linkModel = dynamic_cast<const ILinkPathLoss*>(model);
+        if (!linkModel) {
+            ++mSkippedLinks;
+            if (mVerify && linkClass != link.linkClass) {
+                reportMismatch(link, linkClass, loss, sigma);
+            }
+            return;
+        }
+
+        Stage stage = NumStages;
+        switch (linkClass) {
+            case LinkClass::LOS:
+                stage = LOS;
+                break;
+            case LinkClass::NLOSb:
+                stage = NLOSb;
+                break;
+            case LinkClass::NLOSf:
+                stage = NLOSf;
+                break;
+            case LinkClass::NLOSv:
+                stage = NLOSv;
+                break;
+        }
+        ASSERT(stage != NumStages);
+
+        start = Clock::now();
+        loss = linkModel->computeLinkPathLoss(link.tx, link.rx, inet::mps(link.propagationSpeed), inet::Hz(link.carrierFrequency));
+        measure(stage, start);
+
+        if (mSmallScale) {
+            start = Clock::now();
+            sigma = mSmallScale->computeDeviation(tx, rx, range, linkClass).sigma;
+            measure(SmallScale, start);
+        }
+    }
+
+    ++mReplayedLinks;
+    if (mVerify && (linkClass != link.linkClass || !identical(loss, link.loss) || !identical(sigma, link.sigma))) {
+        reportMismatch(link, linkClass, loss, sigma);
+    }
+}
+
+void LinkTraceReplay::reportMismatch(const LinkTrace::Link& link, LinkClass linkClass, double loss, double sigma)
+{
+    if (mMismatches < maxReportedMismatches) {
+        EV_WARN << std::setprecision(17) << "link " << link.tx << " -> " << link.rx << " at " << link.time << " s differs: "
+            << getLinkClassName(link.linkClass) << " / " << getLinkClassName(linkClass) << ", "
+            << "loss " << link.loss << " / " << loss << ", sigma " << link.sigma << " / " << sigma
+            << " (recorded / replayed)\n";
+    }
+    ++mMismatches;
+}
+
+} // namespace gemv2
+} // namespace artery
@@ -0,0 +1,81 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_LINKTRACEREPLAY_H_JX2M8TQA
+#define ARTERY_GEMV2_LINKTRACEREPLAY_H_JX2M8TQA
+
+#include "artery/inet/gemv2/LinkTrace.h"
+#include <omnetpp/csimplemodule.h>
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace artery
+{
+namespace gemv2
+{
+
+// forward declarations
+class LinkClassifier;
+class ObstacleIndex;
+class PathLoss;
+class SmallScaleVariation;
+class VehicleIndex;
+
+/**
+ * LinkTraceReplay feeds a recorded LinkTrace through the components of a GEMV2 path loss module.
+ *
+ * Obstacles and vehicle snapshots of the trace are injected into GEMV2's indices,
+ * i.e. neither SUMO nor INET's radio stack are involved. Each link is classified,
+ * evaluated by its link class' model and its small scale deviation is computed.
+ * Time spent per component is reported as throughput. Optionally, replayed results
+ * are verified to be bit-identical to the recorded ones.
+ *
+ * Path loss models are replayed if they implement ILinkPathLoss, other models are skipped.
+ */
+class LinkTraceReplay : public omnetpp::cSimpleModule
+{
+public:
+    void initialize() override;
+    void handleMessage(omnetpp::cMessage*) override;
+    void finish() override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    enum Stage { Snapshots, Classifier, LOS, NLOSb, NLOSf, NLOSv, SmallScale, NumStages };
+
+    struct Throughput
+    {
+        unsigned long count = 0;
+        Clock::duration time = Clock::duration::zero();
+    };
+
+    void replay();
+    void loadSnapshot(const LinkTrace&, std::uint32_t snapshot);
+    void replayLink(const LinkTrace::Link&);
+    void reportMismatch(const LinkTrace::Link&, LinkClass, double loss, double sigma);
+
+    PathLoss* mPathLoss = nullptr;
+    LinkClassifier* mClassifier = nullptr;
+    ObstacleIndex* mObstacleIndex = nullptr;
+    ObstacleIndex* mFoliageIndex = nullptr;
+    VehicleIndex* mVehicleIndex = nullptr;
+    SmallScaleVariation* mSmallScale = nullptr;
+
+    bool mVerify = true;
+    double mNetWidth = 0.0;
+    double mNetHeight = 0.0;
+    std::array<Throughput, NumStages> mThroughput;
+    unsigned long mReplayedLinks = 0;
+    unsigned long mSkippedLinks = 0; /*< links whose model does not implement ILinkPathLoss */
+    unsigned long mMismatches = 0;
+};
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_LINKTRACEREPLAY_H_JX2M8TQA */
@@ -53,16 +53,6 @@ Position reflectPoint(const Position& p, const PositionSegment& line)
     return q;
 }
 
-inet::m getWaveLength(const inet::physicallayer::ITransmission* transmission)
-{
-    auto radioMedium = transmission->getTransmitter()->getMedium();
-    auto narrowbandSignalAnalogModel = check_and_cast<const phy::INarrowbandSignal *>(transmission->getAnalogModel());
-    const mps propagationSpeed = radioMedium->getPropagation()->getPropagationSpeed();
-    const Hz carrierFrequency = Hz(narrowbandSignalAnalogModel->getCarrierFrequency());
-    const m waveLength = propagationSpeed / carrierFrequency;
-    return waveLength;
-}
-
 } // namespace
 
 
@@ -108,8 +98,15 @@ m NLOSb::computeRange(mps propagationSpeed, Hz frequency, double loss) const
 
 double NLOSb::computePathLoss(const phy::ITransmission* transmission, const phy::IArrival* arrival) const
 {
-    const Environment env(this, transmission->getStartPosition(), arrival->getStartPosition(), getWaveLength(transmission));
-    const inet::m distRxTx { transmission->getStartPosition().distance(arrival->getStartPosition()) };
+    return computeLinkPathLoss(transmission->getStartPosition(), arrival->getStartPosition(),
+            getPropagationSpeed(transmission), getCarrierFrequency(transmission));
+}
+
+double NLOSb::computeLinkPathLoss(const Coord& tx, const Coord& rx, mps propagationSpeed, Hz carrierFrequency) const
+{
+    const m waveLength = propagationSpeed / carrierFrequency;
+    const Environment env(this, tx, rx, waveLength);
+    const inet::m distRxTx { tx.distance(rx) };
 
     std::vector<Position> reflBuildings = computeReflectionRaysFromBuildings(env);
     std::vector<Attenuation> attReflBuildings = computeReflectionAttenuation(reflBuildings, obsReflRelPerm, env);
@@ -150,35 +147,14 @@ double NLOSb::computePathLoss(const phy::ITransmission* transmission, const phy:
 std::vector<Position> NLOSb::computeReflectionRaysFromBuildings(const Environment& env) const
 {
     std::vector<Position> rays;
-    std::vector<Position> intersections;
-    const double squaredLengthTxRx = squaredLength(env.tx, env.rx);
+    std::vector<const ObstacleIndex::Wall*> walls;
+    mObstacleIndex->obstacleWalls(env.obstacles, walls);
 
-    for (const ObstacleIndex::Obstacle* obstacle : env.obstacles)
+    Position reflection;
+    for (const ObstacleIndex::Wall* wall : walls)
     {
-        const PositionRange& outline = obstacle->getOutline();
-        if (outline.size() < 2) continue;
-
-        PositionView view(outline);
-        for (auto a = view.begin(), b = std::next(a); b != view.end(); ++a, ++b)
-        {
-            PositionSegment segment(*a, *b);
-
-            // calculate mirror point Rx' of Rx w.r.t. segment
-            Position rx_m = reflectPoint(env.rx, segment);
-
-            // no valid reflection possible if d(Tx, Rx) > d(Tx, Rx')
-            if (squaredLengthTxRx > squaredLength(env.tx, rx_m)) {
-                // skip segment because Tx and Rx are on opposite sides of segment
-                continue;
-            }
-
-            // intersection between ray TxRx' and segment is reflection point
-            PositionSegment ray(env.tx, rx_m);
-            bg::intersection(segment, ray, intersections);
-            if (intersections.size() == 1 && !isRayObstructed(intersections[0], env)) {
-                rays.emplace_back(intersections[0]);
-            }
-            intersections.clear();
+        if (reflectAtWall(*wall, env.tx, env.rx, reflection) && !isRayObstructed(reflection, env)) {
+            rays.emplace_back(reflection);
         }
     }
 
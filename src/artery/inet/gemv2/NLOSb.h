@@ -7,6 +7,7 @@
 #ifndef ARTERY_GEMV2_NLOSB_H_NV3WEACB
 #define ARTERY_GEMV2_NLOSB_H_NV3WEACB
 
+#include "artery/inet/gemv2/LinkPathLoss.h"
 #include "artery/inet/gemv2/ObstacleIndex.h"
 #include "artery/inet/gemv2/VehicleIndex.h"
 #include <inet/common/ModuleAccess.h>
@@ -22,7 +23,7 @@ namespace gemv2
 
 class Visualizer;
 
-class NLOSb : public omnetpp::cSimpleModule, public inet::physicallayer::IPathLoss
+class NLOSb : public omnetpp::cSimpleModule, public inet::physicallayer::IPathLoss, public ILinkPathLoss
 {
 public:
     NLOSb();
@@ -30,6 +31,7 @@ public:
     double computePathLoss(const inet::physicallayer::ITransmission*, const inet::physicallayer::IArrival*) const override;
     double computePathLoss(inet::mps propagation, inet::Hz frequency, inet::m distance) const override;
     inet::m computeRange(inet::mps propagation, inet::Hz frequency, double loss) const override;
+    double computeLinkPathLoss(const inet::Coord& tx, const inet::Coord& rx, inet::mps propagation, inet::Hz frequency) const override;
 
 protected:
     using VehicleList = std::vector<const VehicleIndex::Vehicle*>;
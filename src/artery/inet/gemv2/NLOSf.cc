@@ -11,18 +11,14 @@
 #include <inet/common/ModuleAccess.h>
 #include <inet/common/Units.h>
 #include <inet/physicallayer/contract/packetlevel/IRadioMedium.h>
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/register/linestring.hpp>
+#include <boost/geometry/algorithms/within.hpp>
 #include <algorithm>
-#include <array>
+#include <cmath>
 #include <iterator>
-#include <list>
+#include <limits>
 
 using namespace inet;
 
-namespace { using PositionSegment = std::array<artery::Position, 2>; }
-BOOST_GEOMETRY_REGISTER_LINESTRING(PositionSegment)
-
 namespace artery
 {
 namespace gemv2
@@ -50,15 +46,17 @@ std::ostream& NLOSf::printToStream(std::ostream& stream, int level) const
 
 double NLOSf::computePathLoss(const physicallayer::ITransmission *transmission, const physicallayer::IArrival *arrival) const
 {
-    auto radioMedium = transmission->getTransmitter()->getMedium();
-    auto narrowbandSignalAnalogModel = check_and_cast<const physicallayer::INarrowbandSignal *>(transmission->getAnalogModel());
-    const mps propagationSpeed = radioMedium->getPropagation()->getPropagationSpeed();
-    const Hz carrierFrequency = narrowbandSignalAnalogModel->getCarrierFrequency();
+    return computeLinkPathLoss(transmission->getStartPosition(), arrival->getStartPosition(),
+            getPropagationSpeed(transmission), getCarrierFrequency(transmission));
+}
+
+double NLOSf::computeLinkPathLoss(const Coord& tx, const Coord& rx, mps propagationSpeed, Hz carrierFrequency) const
+{
     const m waveLength = propagationSpeed / carrierFrequency;
-    const m dist { transmission->getStartPosition().distance(arrival->getStartPosition()) };
+    const m dist { tx.distance(rx) };
 
     const double attenuationPerMeter_dB = 0.79 * std::pow(GHz(carrierFrequency).get(), 0.61);
-    const inet::m foliageDist = computeDistanceThroughFoliage(transmission->getStartPosition(), arrival->getStartPosition());
+    const inet::m foliageDist = computeDistanceThroughFoliage(tx, rx);
     const double foliageAttenuation_dB = attenuationPerMeter_dB * foliageDist.get();
     const double freeSpaceLoss = computeFreeSpacePathLoss(waveLength, dist, alpha, systemLoss);
     return freeSpaceLoss / math::dB2fraction(foliageAttenuation_dB);
@@ -70,107 +68,158 @@ double NLOSf::computePathLoss(mps propagationSpeed, Hz carrierFrequency, m dista
     return NaN;
 }
 
+NLOSf::Scratch& NLOSf::getScratch()
+{
+    static thread_local Scratch scratch;
+    return scratch;
+}
+
 m NLOSf::computeDistanceThroughFoliage(const Coord& tx, const Coord& rx) const
 {
     const Position start { tx.x, tx.y };
     const Position end { rx.x, rx.y };
-    const PositionSegment ray { start, end };
-
-    std::list<PositionLineString> intersections;
-    const auto plants = mFoliageIndex->getObstructingObstacles(start, end);
-    for (const ObstacleIndex::Obstacle* plant : plants)
-    {
-        boost::geometry::intersection(ray, plant->getOutline(), intersections);
+    const double dx = rx.x - tx.x;
+    const double dy = rx.y - tx.y;
+    const double length = std::sqrt(dx * dx + dy * dy); /*< ground distance */
+
+    Scratch& scratch = getScratch();
+    scratch.intervals.clear();
+    if (length > 0.0) {
+        findFoliageIntervals(start, end, scratch);
     }
-    inet::m dist = mergeIntervals(intersections, start);
+    const double fraction = mergeIntervals(scratch.intervals);
 
     if (mVisualizer) {
         std::vector<Position> visualization;
-        visualization.reserve(intersections.size() * 2);
-        for (const PositionLineString& ls : intersections)
+        visualization.reserve(scratch.intervals.size() * 2);
+        for (const Interval& interval : scratch.intervals)
         {
-            std::copy(ls.begin(), ls.end(), std::back_inserter(visualization));
+            visualization.emplace_back(tx.x + interval.t0 * dx, tx.y + interval.t0 * dy);
+            visualization.emplace_back(tx.x + interval.t1 * dx, tx.y + interval.t1 * dy);
         }
         mVisualizer->drawFoliageRay(start, end, visualization);
     }
 
-    return dist;
+    return m { fraction * length };
 }
 
-inet::m NLOSf::mergeIntervals(std::list<PositionLineString>& lines, const Position& ref) const
+void NLOSf::findFoliageIntervals(const Position& a, const Position& b, Scratch& scratch) const
 {
-    using LineIterator = std::list<PositionLineString>::iterator;
-    struct OrderedLineString
-    {
-        OrderedLineString(LineIterator it, double idxStart, double idxStop) :
-            line(it), indexStart(idxStart), indexStop(idxStop) { ASSERT(indexStart <= indexStop); }
-        bool operator<(const OrderedLineString& other) const { return this->indexStart < other.indexStart; }
-
-        LineIterator line;
-        double indexStart;
-        double indexStop;
+    const double ax = a.x.value();
+    const double ay = a.y.value();
+    const double dx = b.x.value() - ax;
+    const double dy = b.y.value() - ay;
+    const double dd = dx * dx + dy * dy;
+
+    // Crossings of each plant are paired by parity, i.e. counting has to start outside of the plant.
+    // Plants covering the link's start are entered before it: extend the link backwards beyond their bounding boxes.
+    scratch.boxes.clear();
+    mFoliageIndex->obstacleBoxes(a, scratch.boxes);
+    double tmin = 0.0;
+    for (const auto& box : scratch.boxes) {
+        const geometry::Point& lower = box.first.min_corner();
+        const geometry::Point& upper = box.first.max_corner();
+        // link enters box when it has entered the slabs of both axes
+        double entry = -std::numeric_limits<double>::infinity();
+        if (dx != 0.0) {
+            entry = std::max(entry, std::min((lower.get<0>() - ax) / dx, (upper.get<0>() - ax) / dx));
+        }
+        if (dy != 0.0) {
+            entry = std::max(entry, std::min((lower.get<1>() - ay) / dy, (upper.get<1>() - ay) / dy));
+        }
+        tmin = std::min(tmin, entry);
+    }
+    if (tmin < 0.0) {
+        tmin -= 1.0 / std::sqrt(dd); // one metre margin against rounding
+    }
+    auto coversStart = [&scratch](std::size_t plant) {
+        return std::any_of(scratch.boxes.begin(), scratch.boxes.end(),
+                [plant](const std::pair<geometry::Box, std::size_t>& box) { return box.second == plant; });
     };
 
-    // there is nothing to merge so bail out quickly
-    if (lines.empty()) {
-        return inet::m { 0.0 };
-    } else if (lines.size() == 1) {
-        return inet::m { static_cast<double>(boost::geometry::length(lines.front())) };
+    // edge index yields candidate edges near the link only instead of whole outlines
+    scratch.edges.clear();
+    mFoliageIndex->wallsSegment(Position { ax + tmin * dx, ay + tmin * dy }, b, scratch.edges);
+    scratch.crossings.clear();
+    for (const ObstacleIndex::Wall* edge : scratch.edges) {
+        // signed sides of edge points relative to link, points on the link count as negative side
+        const double sa = dx * (edge->a.y.value() - ay) - dy * (edge->a.x.value() - ax);
+        const double sb = dx * (edge->b.y.value() - ay) - dy * (edge->b.x.value() - ax);
+        if ((sa > 0.0) == (sb > 0.0)) {
+            continue;
+        }
+
+        const double u = sa / (sa - sb);
+        const double qx = edge->a.x.value() + u * (edge->b.x.value() - edge->a.x.value());
+        const double qy = edge->a.y.value() + u * (edge->b.y.value() - edge->a.y.value());
+        const double t = ((qx - ax) * dx + (qy - ay) * dy) / dd;
+        if (t > 1.0 || (t < 0.0 && !coversStart(edge->obstacle))) {
+            continue;
+        }
+        scratch.crossings.push_back(Crossing { edge->obstacle, t, sa == 0.0 || sb == 0.0 });
     }
 
-    auto calculateIndex = [&ref](const Position& pos) -> double {
-        return (squared(pos.x - ref.x) + squared(pos.y - ref.y)).value();
-    };
+    std::sort(scratch.crossings.begin(), scratch.crossings.end(),
+            [](const Crossing& lhs, const Crossing& rhs) {
+                return lhs.plant < rhs.plant || (lhs.plant == rhs.plant && lhs.t < rhs.t);
+            });
 
-    // create index entry for each line segment
-    std::list<OrderedLineString> ordered;
-    for (auto it = lines.begin(); it != lines.end();)
-    {
-        if (it->size() != 2) {
-            it = lines.erase(it);
-            continue;
+    for (auto first = scratch.crossings.begin(); first != scratch.crossings.end();) {
+        auto last = first;
+        while (last != scratch.crossings.end() && last->plant == first->plant) {
+            ++last;
         }
 
-        const double index1 = calculateIndex((*it)[0]);
-        const double index2 = calculateIndex((*it)[1]);
-        if (index1 < index2) {
-            ordered.emplace_back(it, index1, index2);
-        } else {
-            boost::geometry::reverse(*it);
-            ordered.emplace_back(it, index2, index1);
+        // like boost::geometry::crosses, plants covering the whole link are no obstruction
+        const bool crossed = std::any_of(first, last, [](const Crossing& crossing) { return crossing.t >= 0.0; });
+        // parity is ambiguous if the link runs along edges, reject sections on the outline then
+        const bool touching = std::any_of(first, last, [](const Crossing& crossing) { return crossing.touching; });
+        const std::vector<Position>& outline = mFoliageIndex->getObstacles()[first->plant].getOutline();
+        for (auto entry = first; crossed && entry != last;) {
+            // link remains within plant beyond its end if there is no exiting crossing
+            const auto exit = std::next(entry);
+            const double t0 = std::max(entry->t, 0.0);
+            const double t1 = exit != last ? std::min(exit->t, 1.0) : 1.0;
+            const double tm = 0.5 * (t0 + t1);
+            if (t0 < t1 && (!touching || boost::geometry::within(Position { ax + tm * dx, ay + tm * dy }, outline))) {
+                scratch.intervals.push_back(Interval { t0, t1 });
+            }
+            entry = exit != last ? std::next(exit) : last;
         }
+        first = last;
+    }
+}
 
-        ++it;
+double NLOSf::mergeIntervals(std::vector<Interval>& intervals)
+{
+    // there is nothing to merge so bail out quickly
+    if (intervals.empty()) {
+        return 0.0;
     }
-    ASSERT(ordered.size() == lines.size());
-    ordered.sort();
-
-    // move lines to backlog (some of them are moved back in new order later)
-    std::list<PositionLineString> backlog;
-    backlog.splice(backlog.end(), lines);
-    ASSERT(lines.size() == 0);
-
-    // merge overlapping segments and calculate total distance through foliage
-    inet::m dist { 0.0 };
-    auto current = ordered.begin();
-    lines.splice(lines.end(), backlog, current->line);
-    for (auto it = std::next(current); it != ordered.end(); ++it)
+
+    std::sort(intervals.begin(), intervals.end(),
+            [](const Interval& lhs, const Interval& rhs) { return lhs.t0 < rhs.t0; });
+
+    // merge overlapping intervals in place and sum up their lengths
+    auto current = intervals.begin();
+    for (auto it = std::next(current); it != intervals.end(); ++it)
     {
-        if (current->indexStop < it->indexStart) {
-            // disjoint intervals: add interval to output
-            dist += inet::m { std::sqrt(current->indexStop) - std::sqrt(current->indexStart) };
-            current = it;
-            lines.splice(lines.end(), backlog, current->line);
-        } else if (current->indexStop < it->indexStop) {
-            // overlapping intervals: adjust stop of first and remove other
-            current->line->back() = it->line->back();
-            current->indexStop = it->indexStop;
+        if (current->t1 < it->t0) {
+            // disjoint intervals: keep next interval
+            *++current = *it;
+        } else if (current->t1 < it->t1) {
+            // overlapping intervals: extend current interval
+            current->t1 = it->t1;
         }
         // else: interval completely covered by current (no op)
     }
-    dist += inet::m { std::sqrt(current->indexStop) - std::sqrt(current->indexStart) };
+    intervals.erase(std::next(current), intervals.end());
 
-    return dist;
+    double sum = 0.0;
+    for (const Interval& interval : intervals) {
+        sum += interval.t1 - interval.t0;
+    }
+    return sum;
 }
 
 } // namespace gemv2
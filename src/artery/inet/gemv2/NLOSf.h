@@ -7,33 +7,82 @@
 #ifndef ARTERY_GEMV2_NLOSF_H_WLNRGJIS
 #define ARTERY_GEMV2_NLOSF_H_WLNRGJIS
 
+#include "artery/inet/gemv2/LinkPathLoss.h"
 #include "artery/inet/gemv2/Math.h"
+#include "artery/inet/gemv2/ObstacleIndex.h"
 #include "artery/utility/Geometry.h"
-#include <boost/geometry/geometries/linestring.hpp>
 #include <inet/physicallayer/pathloss/FreeSpacePathLoss.h>
+#include <cstddef>
+#include <utility>
+#include <vector>
 
 namespace artery
 {
 namespace gemv2
 {
 
-// forward declarations
-class ObstacleIndex;
+// forward declaration
 class Visualizer;
 
-class NLOSf : public inet::physicallayer::FreeSpacePathLoss
+class NLOSf : public inet::physicallayer::FreeSpacePathLoss, public ILinkPathLoss
 {
 public:
     void initialize(int stage) override;
     std::ostream& printToStream(std::ostream& stream, int level) const override;
     double computePathLoss(const inet::physicallayer::ITransmission *transmission, const inet::physicallayer::IArrival *arrival) const override;
     double computePathLoss(inet::mps propagation, inet::Hz frequency, inet::m distance) const override;
+    double computeLinkPathLoss(const inet::Coord& tx, const inet::Coord& rx, inet::mps propagation, inet::Hz frequency) const override;
 
 protected:
-    using PositionLineString = boost::geometry::model::linestring<Position>;
+    /**
+     * Section of a link within foliage, parametrized from transmitter (0) to receiver (1)
+     */
+    struct Interval
+    {
+        double t0;
+        double t1;
+    };
+
+    /**
+     * Crossing of a link with an edge of a foliage outline
+     */
+    struct Crossing
+    {
+        std::size_t plant; /*< index of foliage obstacle */
+        double t; /*< link parameter of crossing */
+        bool touching; /*< an edge point lies exactly on the link */
+    };
+
+    /**
+     * Scratch buffers reused for each link, i.e. link evaluation does not allocate once buffers have grown.
+     * Each thread has its own buffers, thus links can be evaluated concurrently.
+     */
+    struct Scratch
+    {
+        std::vector<const ObstacleIndex::Wall*> edges;
+        std::vector<std::pair<geometry::Box, std::size_t>> boxes; /*< foliage covering transmitter */
+        std::vector<Crossing> crossings;
+        std::vector<Interval> intervals;
+    };
+
+    static Scratch& getScratch();
 
     inet::m computeDistanceThroughFoliage(const inet::Coord& a, const inet::Coord& b) const;
-    inet::m mergeIntervals(std::list<PositionLineString>&, const Position&) const;
+
+    /**
+     * Find sections of a link within foliage crossed by this link
+     * \param a link start
+     * \param b link end
+     * \param scratch buffers, sections are stored in its intervals (unordered and possibly overlapping)
+     */
+    void findFoliageIntervals(const Position& a, const Position& b, Scratch& scratch) const;
+
+    /**
+     * Merge overlapping intervals
+     * \param intervals unordered intervals, replaced by disjoint intervals in ascending order
+     * \return summed length of merged intervals
+     */
+    static double mergeIntervals(std::vector<Interval>& intervals);
 
     const ObstacleIndex* mFoliageIndex = nullptr;
     Visualizer* mVisualizer = nullptr;
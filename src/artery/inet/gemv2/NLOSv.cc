@@ -10,6 +10,7 @@
 #include <inet/common/ModuleAccess.h>
 #include <inet/common/Units.h>
 #include <inet/physicallayer/contract/packetlevel/IRadioMedium.h>
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <vector>
@@ -26,11 +27,15 @@ namespace phy = inet::physicallayer;
 
 namespace {
 auto compareDistance = [](const DiffractionObstacle& a, const DiffractionObstacle& b) { return a.d < b.d; };
-auto compareHeight = [](const DiffractionObstacle& a, const DiffractionObstacle& b) { return a.h < b.h; };
 
-using ObstacleIterator = std::list<DiffractionObstacle>::const_iterator;
-ObstacleIterator findMainObstacle(ObstacleIterator, ObstacleIterator);
-ObstacleIterator findSecondaryObstacle(ObstacleIterator, ObstacleIterator);
+std::size_t findMainObstacle(const DiffractionObstacles&, std::size_t);
+std::size_t findSecondaryObstacle(const DiffractionObstacles&, std::size_t, std::size_t);
+
+// insert obstacle behind all obstacles not farther away, i.e. a stable insertion sort without allocations
+void insertByDistance(DiffractionObstacles& obstacles, const DiffractionObstacle& obstacle)
+{
+    obstacles.insert(std::upper_bound(obstacles.begin(), obstacles.end(), obstacle, compareDistance), obstacle);
+}
 } // namespace
 
 DiffractionObstacle::DiffractionObstacle(meter distTx, meter height) :
@@ -55,52 +60,65 @@ void NLOSv::initialize()
 
 double NLOSv::computePathLoss(const phy::ITransmission* transmission, const phy::IArrival* arrival) const
 {
-    auto radioMedium = transmission->getTransmitter()->getMedium();
-    auto narrowbandSignalAnalogModel = check_and_cast<const phy::INarrowbandSignal *>(transmission->getAnalogModel());
-    const mps propagationSpeed = radioMedium->getPropagation()->getPropagationSpeed();
-    const Hz carrierFrequency = Hz(narrowbandSignalAnalogModel->getCarrierFrequency());
+    return computeLinkPathLoss(transmission->getStartPosition(), arrival->getStartPosition(),
+            getPropagationSpeed(transmission), getCarrierFrequency(transmission));
+}
+
+double NLOSv::computeLinkPathLoss(const Coord& tx, const Coord& rx, mps propagationSpeed, Hz carrierFrequency) const
+{
     const m waveLength = propagationSpeed / carrierFrequency;
-    const m distance { transmission->getStartPosition().distance(arrival->getStartPosition()) };
+    const m distance { tx.distance(rx) };
 
     double loss = 1.0;
     if (distance.get() != 0.0) {
         // free space loss
         loss = static_cast<inet::unit>(squared(waveLength) / (16.0 * squared(M_PI) * squared(distance))).get();
         // and additional attenuation by vehicles
-        loss *= computeVehiclePathLoss(transmission->getStartPosition(), arrival->getStartPosition(), waveLength);
+        loss *= computeVehiclePathLoss(tx, rx, waveLength);
     }
     ASSERT(loss >= 0.0 && loss <= 1.0);
     return loss;
 }
 
+NLOSv::Scratch& NLOSv::getScratch()
+{
+    static thread_local Scratch scratch;
+    return scratch;
+}
+
 double NLOSv::computeVehiclePathLoss(const Coord& pos_tx, const Coord& pos_rx, m lambda) const
 {
     const meter distTxRx { sqrt(squared(pos_rx.x - pos_tx.x) + squared(pos_rx.y - pos_tx.y)) }; /*< ground distance! */
     DiffractionObstacle Tx { meter(0.0), meter(pos_tx.z) };
     DiffractionObstacle Rx { distTxRx, meter(pos_rx.z) };
 
-    auto vehicles = mVehicleIndex->getObstructingVehicles(Position { pos_tx.x, pos_tx.y }, Position { pos_rx.x, pos_rx.y });
-    std::vector<DiffractionPath> paths;
-    paths.reserve(3);
+    Scratch& scratch = getScratch();
+    VehicleList& vehicles = scratch.vehicles;
+    vehicles.clear();
+    mVehicleIndex->getObstructingVehicles(Position { pos_tx.x, pos_tx.y }, Position { pos_rx.x, pos_rx.y }, vehicles);
+    std::vector<DiffractionPath>& paths = scratch.paths;
+    paths.clear();
 
-    auto obsTop = buildTopObstacles(vehicles, pos_tx, pos_rx);
+    DiffractionObstacles& obsTop = scratch.top;
+    buildTopObstacles(vehicles, pos_tx, pos_rx, obsTop);
     if (!obsTop.empty()) {
-        obsTop.push_front(Tx);
+        obsTop.insert(obsTop.begin(), Tx);
         obsTop.push_back(Rx);
         paths.push_back(computeMultipleKnifeEdge(obsTop, lambda));
     }
 
     // original GEMV² code uses same Tx and Rx heights for all three paths: we assume zero "height" on side paths
-    auto obsSides = buildSideObstacles(vehicles, pos_tx, pos_rx);
+    SideObstacles& obsSides = scratch.sides;
+    buildSideObstacles(vehicles, pos_tx, pos_rx, obsSides);
     Tx.h = meter(0.0);
     Rx.h = meter(0.0);
     if (!obsSides.left.empty()) {
-        obsSides.left.push_front(Tx);
+        obsSides.left.insert(obsSides.left.begin(), Tx);
         obsSides.left.push_back(Rx);
         paths.push_back(computeMultipleKnifeEdge(obsSides.left, lambda));
     }
     if (!obsSides.right.empty()) {
-        obsSides.right.push_front(Tx);
+        obsSides.right.insert(obsSides.right.begin(), Tx);
         obsSides.right.push_back(Rx);
         paths.push_back(computeMultipleKnifeEdge(obsSides.right, lambda));
     }
@@ -151,44 +169,41 @@ double NLOSv::computeSimpleKnifeEdge(m heightTx, m heightRx, m heightObs, m dist
     return loss;
 }
 
-DiffractionPath NLOSv::computeMultipleKnifeEdge(const std::list<DiffractionObstacle>& obs, m lambda) const
+DiffractionPath NLOSv::computeMultipleKnifeEdge(const DiffractionObstacles& obs, m lambda) const
 {
     ASSERT(obs.size() > 2);
     DiffractionPath path;
 
-    // determine main and secondary obstacles
-    std::vector<ObstacleIterator> mainObs;
-    mainObs.push_back(obs.begin()); // Tx
-    for (ObstacleIterator it = obs.begin(); it != obs.end();) {
-        it = findMainObstacle(it, obs.end());
-        if (it != obs.end()) {
-            mainObs.push_back(it);
+    // determine main obstacles
+    Scratch& scratch = getScratch();
+    std::vector<std::size_t>& mainObs = scratch.mainObstacles;
+    mainObs.clear();
+    mainObs.push_back(0); // Tx
+    for (std::size_t i = 0; i < obs.size();) {
+        i = findMainObstacle(obs, i);
+        if (i < obs.size()) {
+            mainObs.push_back(i);
         }
     }
     // NOTE: Rx is added by loop as last main obstacle
     ASSERT(mainObs.size() <= obs.size());
 
-    struct SecondaryObstacle {
-        SecondaryObstacle(ObstacleIterator tx, ObstacleIterator obs, ObstacleIterator rx) :
-            tx(tx), obstacle(obs), rx(rx) {}
-        ObstacleIterator tx;
-        ObstacleIterator obstacle;
-        ObstacleIterator rx;
-    };
-
-    std::vector<SecondaryObstacle> secObs;
-    std::vector<meter> mainObsDistances;
+    // attenuation due to secondary obstacles, i.e. the most relevant obstacle between two main obstacles
+    double attSecObs = 0.0;
+    std::vector<meter>& mainObsDistances = scratch.mainDistances;
+    mainObsDistances.clear();
     for (std::size_t i = 0, j = 1; j < mainObs.size(); ++i, ++j) {
-        const meter d = mainObs[j]->d - mainObs[i]->d;
-        path.d += sqrt(squared(d) + squared(mainObs[j]->h - mainObs[i]->h));
+        const DiffractionObstacle& first = obs[mainObs[i]];
+        const DiffractionObstacle& last = obs[mainObs[j]];
+        const meter d = last.d - first.d;
+        path.d += sqrt(squared(d) + squared(last.h - first.h));
         mainObsDistances.push_back(d);
 
-        const auto delta = std::distance(mainObs[i], mainObs[j]);
-        if (delta == 2) {
-            // single other obstacle between two main obstacles
-            secObs.emplace_back(mainObs[i], std::next(mainObs[i]), mainObs[j]);
-        } else if (delta > 2) {
-            secObs.emplace_back(mainObs[i], findSecondaryObstacle(mainObs[i], mainObs[j]), mainObs[j]);
+        const std::size_t delta = mainObs[j] - mainObs[i];
+        if (delta >= 2) {
+            // single other obstacle between two main obstacles or search for secondary one
+            const std::size_t sec = delta == 2 ? mainObs[i] + 1 : findSecondaryObstacle(obs, mainObs[i], mainObs[j]);
+            attSecObs += computeSimpleKnifeEdge(first.h, last.h, obs[sec].h, d, obs[sec].d - first.d, lambda);
         }
     }
 
@@ -197,19 +212,11 @@ DiffractionPath NLOSv::computeMultipleKnifeEdge(const std::list<DiffractionObsta
     for (std::size_t i = 0; i < mainObs.size() - 2; ++i) {
         const meter distTxObs = mainObsDistances[i];
         const meter distTxRx = distTxObs + mainObsDistances[i+1];
-        attMainObs += computeSimpleKnifeEdge(mainObs[i]->h, mainObs[i+2]->h, mainObs[i+1]->h, distTxRx, distTxObs, lambda);
-    }
-
-    // attenuation due to secondary obstacles
-    double attSecObs = 0.0;
-    for (const SecondaryObstacle& sec : secObs) {
-        const meter distTxRx = sec.rx->d - sec.tx->d;
-        const meter distTxObs = sec.obstacle->d - sec.tx->d;
-        attSecObs += computeSimpleKnifeEdge(sec.tx->h, sec.rx->h, sec.obstacle->h, distTxRx, distTxObs, lambda);
+        attMainObs += computeSimpleKnifeEdge(obs[mainObs[i]].h, obs[mainObs[i+2]].h, obs[mainObs[i+1]].h, distTxRx, distTxObs, lambda);
     }
 
     // correction factor C (see eq. 46 in ITU-R P.526-13)
-    double C = (mainObs.back()->d - mainObs.front()->d).get(); // distance between Tx and Rx
+    double C = (obs[mainObs.back()].d - obs[mainObs.front()].d).get(); // distance between Tx and Rx
     for (meter d : mainObsDistances) {
         C *= d.get();
     }
@@ -224,9 +231,9 @@ DiffractionPath NLOSv::computeMultipleKnifeEdge(const std::list<DiffractionObsta
     return path;
 }
 
-std::list<DiffractionObstacle> NLOSv::buildTopObstacles(const VehicleList& vehicles, const Coord& pos_tx, const Coord& pos_rx) const
+void NLOSv::buildTopObstacles(const VehicleList& vehicles, const Coord& pos_tx, const Coord& pos_rx, DiffractionObstacles& diffTop) const
 {
-    std::list<DiffractionObstacle> diffTop;
+    diffTop.clear();
     const double vx = pos_rx.x - pos_tx.x;
     const double vy = pos_rx.y - pos_tx.y;
 
@@ -235,17 +242,16 @@ std::list<DiffractionObstacle> NLOSv::buildTopObstacles(const VehicleList& vehic
         const double k = (midpoint.x.value() * vx - vy * pos_tx.y + vy * midpoint.y.value() - pos_tx.x * vx) / (squared(vx) + squared(vy));
         if (k < 0.0 || k > 1.0) continue; /*< skip points beyond the ends of TxRx line segment */
         const double d = k * sqrt(squared(vx) + squared(vy));
-        diffTop.emplace_back(meter(d), meter(vehicle->getHeight()));
+        insertByDistance(diffTop, DiffractionObstacle { meter(d), meter(vehicle->getHeight()) });
     }
-
-    diffTop.sort(compareDistance);
-    return diffTop;
 }
 
-NLOSv::SideObstacles NLOSv::buildSideObstacles(const VehicleList& vehicles, const Coord& pos_tx, const Coord& pos_rx) const
+void NLOSv::buildSideObstacles(const VehicleList& vehicles, const Coord& pos_tx, const Coord& pos_rx, SideObstacles& sides) const
 {
-    std::list<DiffractionObstacle> diffOnRightSide;
-    std::list<DiffractionObstacle> diffOnLeftSide;
+    DiffractionObstacles& diffOnRightSide = sides.right;
+    DiffractionObstacles& diffOnLeftSide = sides.left;
+    diffOnRightSide.clear();
+    diffOnLeftSide.clear();
 
     //constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
     constexpr double Inf = std::numeric_limits<double>::infinity();
@@ -303,16 +309,12 @@ NLOSv::SideObstacles NLOSv::buildSideObstacles(const VehicleList& vehicles, cons
         }
 
         if (leftmost.l > -Inf) {
-            diffOnLeftSide.emplace_back(meter(leftmost.k * vl), meter(leftmost.l * vl));
+            insertByDistance(diffOnLeftSide, DiffractionObstacle { meter(leftmost.k * vl), meter(leftmost.l * vl) });
         }
         if (rightmost.l < Inf) {
-            diffOnRightSide.emplace_back(meter(rightmost.k * vl), meter(-rightmost.l * vl));
+            insertByDistance(diffOnRightSide, DiffractionObstacle { meter(rightmost.k * vl), meter(-rightmost.l * vl) });
         }
     }
-
-    diffOnLeftSide.sort(compareDistance);
-    diffOnRightSide.sort(compareDistance);
-    return SideObstacles { std::move(diffOnLeftSide), std::move(diffOnRightSide) };
 }
 
 double NLOSv::combineDiffractionLoss(const std::vector<DiffractionPath>& paths, m /* lambda */) const
@@ -332,42 +334,42 @@ double NLOSv::combineDiffractionLoss(const std::vector<DiffractionPath>& paths,
 
 namespace {
 
-ObstacleIterator findMainObstacle(ObstacleIterator begin, ObstacleIterator end)
+std::size_t findMainObstacle(const DiffractionObstacles& obs, std::size_t begin)
 {
-    ObstacleIterator mainIterator = end;
+    std::size_t main = obs.size();
     double mainAngle = -std::numeric_limits<double>::infinity();
 
-    if (begin != end) {
-        for (ObstacleIterator it = std::next(begin); it != end; ++it) {
-            double angle = static_cast<inet::unit>((it->h - begin->h) / (it->d - begin->d)).get();
+    if (begin < obs.size()) {
+        for (std::size_t i = begin + 1; i < obs.size(); ++i) {
+            double angle = static_cast<inet::unit>((obs[i].h - obs[begin].h) / (obs[i].d - obs[begin].d)).get();
             if (angle > mainAngle) {
-                mainIterator = it;
+                main = i;
                 mainAngle = angle;
             }
         }
     }
 
-    return mainIterator;
+    return main;
 }
 
-ObstacleIterator findSecondaryObstacle(ObstacleIterator first, ObstacleIterator last)
+std::size_t findSecondaryObstacle(const DiffractionObstacles& obs, std::size_t first, std::size_t last)
 {
-    ASSERT(std::distance(first, last) > 2);
-    ObstacleIterator secIterator = last;
+    ASSERT(last - first > 2);
+    std::size_t sec = last;
     inet::m secHeightGap { std::numeric_limits<double>::infinity() };
 
-    const inet::m distFirstLast = last->d - first->d;
-    const inet::m heightFirstLast = last->h - first->h;
-    const auto offset = first->h * last->d - first->d * last->h;
-    for (ObstacleIterator it = std::next(first); it != last; ++it) {
-        const inet::m heightGap = ((it->d * heightFirstLast + offset) / distFirstLast) - it->h;
+    const inet::m distFirstLast = obs[last].d - obs[first].d;
+    const inet::m heightFirstLast = obs[last].h - obs[first].h;
+    const auto offset = obs[first].h * obs[last].d - obs[first].d * obs[last].h;
+    for (std::size_t i = first + 1; i != last; ++i) {
+        const inet::m heightGap = ((obs[i].d * heightFirstLast + offset) / distFirstLast) - obs[i].h;
         if (heightGap < secHeightGap) {
-            secIterator = it;
+            sec = i;
             secHeightGap = heightGap;
         }
     }
 
-    return secIterator;
+    return sec;
 }
 
 } // namespace
@@ -1,11 +1,13 @@
 #ifndef ARTERY_GEMV2_NLOSV_H_NV3WEACB
 #define ARTERY_GEMV2_NLOSV_H_NV3WEACB
 
+#include "artery/inet/gemv2/LinkPathLoss.h"
 #include "artery/inet/gemv2/VehicleIndex.h"
 #include <inet/common/Units.h>
 #include <inet/physicallayer/contract/packetlevel/IPathLoss.h>
 #include <omnetpp/csimplemodule.h>
-#include <list>
+#include <cstddef>
+#include <vector>
 
 namespace artery
 {
@@ -22,6 +24,9 @@ struct DiffractionObstacle
     meter h; // height of obstacle
 };
 
+// obstacles ordered by their distance to transmitter
+using DiffractionObstacles = std::vector<DiffractionObstacle>;
+
 struct DiffractionPath
 {
     DiffractionPath();
@@ -30,7 +35,7 @@ struct DiffractionPath
     meter d;
 };
 
-class NLOSv : public omnetpp::cSimpleModule, public inet::physicallayer::IPathLoss
+class NLOSv : public omnetpp::cSimpleModule, public inet::physicallayer::IPathLoss, public ILinkPathLoss
 {
 public:
     NLOSv();
@@ -38,21 +43,37 @@ public:
     double computePathLoss(const inet::physicallayer::ITransmission*, const inet::physicallayer::IArrival*) const override;
     double computePathLoss(inet::mps propagation, inet::Hz frequency, inet::m distance) const override;
     inet::m computeRange(inet::mps propagation, inet::Hz frequency, double loss) const override;
+    double computeLinkPathLoss(const inet::Coord& tx, const inet::Coord& rx, inet::mps propagation, inet::Hz frequency) const override;
 
 protected:
     using VehicleList = std::vector<const VehicleIndex::Vehicle*>;
 
 
     struct SideObstacles {
-        std::list<DiffractionObstacle> left;
-        std::list<DiffractionObstacle> right;
+        DiffractionObstacles left;
+        DiffractionObstacles right;
+    };
+
+    /**
+     * Scratch buffers reused for each link, i.e. link evaluation does not allocate once buffers have grown.
+     * Each thread has its own buffers, thus links can be evaluated concurrently.
+     */
+    struct Scratch {
+        VehicleList vehicles;
+        DiffractionObstacles top;
+        SideObstacles sides;
+        std::vector<DiffractionPath> paths;
+        std::vector<std::size_t> mainObstacles; /*< indices of main obstacles */
+        std::vector<meter> mainDistances; /*< distances between consecutive main obstacles */
     };
 
+    static Scratch& getScratch();
+
     virtual double computeVehiclePathLoss(const inet::Coord&, const inet::Coord&, inet::m lambda) const;
-    virtual DiffractionPath computeMultipleKnifeEdge(const std::list<DiffractionObstacle>&, inet::m lambda) const;
+    virtual DiffractionPath computeMultipleKnifeEdge(const DiffractionObstacles&, inet::m lambda) const;
     virtual double computeSimpleKnifeEdge(inet::m heightTx, inet::m heightRx, inet::m heightObs, inet::m distTxRx, inet::m distTxObs, inet::m lambda) const;
-    virtual std::list<DiffractionObstacle> buildTopObstacles(const VehicleList&, const inet::Coord& tx, const inet::Coord& rx) const;
-    virtual SideObstacles buildSideObstacles(const VehicleList&, const inet::Coord& tx, const inet::Coord& rx) const;
+    virtual void buildTopObstacles(const VehicleList&, const inet::Coord& tx, const inet::Coord& rx, DiffractionObstacles&) const;
+    virtual void buildSideObstacles(const VehicleList&, const inet::Coord& tx, const inet::Coord& rx, SideObstacles&) const;
     virtual double combineDiffractionLoss(const std::vector<DiffractionPath>&, inet::m lambda) const;
 
     const VehicleIndex* mVehicleIndex;
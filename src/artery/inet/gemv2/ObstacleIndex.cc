@@ -7,6 +7,7 @@
 #include "artery/inet/gemv2/ObstacleIndex.h"
 #include "artery/inet/gemv2/Visualizer.h"
 #include "artery/traci/Cast.h"
+#include "artery/traci/PolygonDatabase.h"
 #include "traci/API.h"
 #include "traci/Core.h"
 #include <boost/algorithm/string.hpp>
@@ -19,6 +20,7 @@
 #include <omnetpp/checkandcast.h>
 #include <algorithm>
 #include <array>
+#include <iterator>
 
 namespace bg = boost::geometry;
 
@@ -54,6 +56,9 @@ void ObstacleIndex::initialize()
     boost::split(mFilterTypes, filterTypes, boost::is_any_of(" "));
 
     mVisualizer = inet::findModuleFromPar<Visualizer>(par("visualizerModule"), this, false);
+    const std::string polygonDatabaseModule = par("polygonDatabaseModule").stdstringValue();
+    mPolygonDatabase = polygonDatabaseModule.empty() ? nullptr :
+        inet::getModuleFromPar<PolygonDatabase>(par("polygonDatabaseModule"), this);
     mColor = cFigure::Color(par("obstacleColor"));
 }
 
@@ -62,7 +67,12 @@ void ObstacleIndex::receiveSignal(cComponent* source, simsignal_t signal, const
     Enter_Method_Silent();
     if (signal == traciInitSignal) {
         auto core = check_and_cast<traci::Core*>(source);
-        fetchObstacles(*core->getAPI());
+        if (mPolygonDatabase) {
+            mPolygonDatabase->load(*core->getAPI());
+            fetchObstacles(*mPolygonDatabase);
+        } else {
+            fetchObstacles(*core->getAPI());
+        }
         if (mVisualizer) {
             mVisualizer->drawObstacles(this);
         }
@@ -111,6 +121,45 @@ void ObstacleIndex::fetchObstacles(const traci::API& traci)
         mObstacles.emplace_back(std::move(shape));
     }
 
+    buildRtree();
+    EV_INFO << mObstacles.size() << " obstacles stored (" << ignored << " ignored)\n";
+}
+
+void ObstacleIndex::fetchObstacles(const PolygonDatabase& db)
+{
+    const bool require_filled = par("requireFilled");
+    unsigned ignored = 0;
+    for (const PolygonDatabase::Polygon& polygon : db.getPolygons()) {
+        if (!mFilterTypes.empty() && mFilterTypes.find(polygon.type) == mFilterTypes.end()) {
+            EV_DEBUG << "ignore polygon " << polygon.id << " of type " << polygon.type << "\n";
+            ++ignored;
+        } else if (require_filled && !polygon.filled) {
+            EV_DEBUG << "ignore unfilled polygon " << polygon.id << "\n";
+            ++ignored;
+        } else if (!polygon.valid) {
+            EV_DEBUG << "ignore invalid polygon " << polygon.id << "\n";
+            ++ignored;
+        } else {
+            std::vector<Position> shape = polygon.outline;
+            mObstacles.emplace_back(std::move(shape));
+        }
+    }
+
+    buildRtree();
+    EV_INFO << mObstacles.size() << " obstacles picked from polygon database (" << ignored << " ignored)\n";
+}
+
+void ObstacleIndex::replaceObstacles(std::vector<std::vector<Position>>&& outlines)
+{
+    mObstacles.clear();
+    for (std::vector<Position>& outline : outlines) {
+        mObstacles.emplace_back(std::move(outline));
+    }
+    buildRtree();
+}
+
+void ObstacleIndex::buildRtree()
+{
     struct rtree_value_maker
     {
         RtreeValue operator()(const boost::range::index_value<Obstacle&>& v) const
@@ -123,7 +172,26 @@ void ObstacleIndex::fetchObstacles(const traci::API& traci)
     using namespace boost::adaptors;
     Rtree tree { mObstacles | indexed() | transformed(rtree_value_maker()) };
     mObstacleRtree = std::move(tree);
-    EV_INFO << mObstacles.size() << " obstacles stored (" << ignored << " ignored)\n";
+    buildWallRtree();
+}
+
+void ObstacleIndex::buildWallRtree()
+{
+    mWalls.clear();
+    mWallOffsets.clear();
+    for (std::size_t i = 0; i < mObstacles.size(); ++i) {
+        mWallOffsets.push_back(mWalls.size());
+        appendWalls(mObstacles[i].getOutline(), i, mWalls);
+    }
+    mWallOffsets.push_back(mWalls.size());
+
+    std::vector<RtreeValue> values;
+    values.reserve(mWalls.size());
+    for (std::size_t i = 0; i < mWalls.size(); ++i) {
+        using Indexable = typename RtreeValue::first_type;
+        values.emplace_back(bg::return_envelope<Indexable>(bg::model::segment<Position> { mWalls[i].a, mWalls[i].b }), i);
+    }
+    mWallRtree = Rtree(values.begin(), values.end());
 }
 
 bool ObstacleIndex::anyBlockage(const Position& a, const Position& b) const
@@ -169,6 +237,32 @@ ObstacleIndex::obstaclesEllipse(const Position& a, const Position& b, double r)
     return obstacles;
 }
 
+void ObstacleIndex::obstacleWalls(const std::vector<const Obstacle*>& obstacles, std::vector<const Wall*>& walls) const
+{
+    for (const Obstacle* obstacle : obstacles) {
+        const std::size_t index = obstacle - mObstacles.data();
+        ASSERT(index < mObstacles.size());
+        for (std::size_t i = mWallOffsets[index]; i < mWallOffsets[index + 1]; ++i) {
+            walls.push_back(&mWalls[i]);
+        }
+    }
+}
+
+void ObstacleIndex::wallsSegment(const Position& a, const Position& b, std::vector<const Wall*>& walls) const
+{
+    const LineOfSight segment { a, b };
+    auto rtree_intersect = bg::index::intersects(segment);
+    for (auto it = mWallRtree.qbegin(rtree_intersect); it != mWallRtree.qend(); ++it) {
+        walls.push_back(&mWalls[it->second]);
+    }
+}
+
+void ObstacleIndex::obstacleBoxes(const Position& p, std::vector<std::pair<geometry::Box, std::size_t>>& boxes) const
+{
+    auto rtree_intersect = bg::index::intersects(geometry::Point { p.x.value(), p.y.value() });
+    mObstacleRtree.query(rtree_intersect, std::back_inserter(boxes));
+}
+
 std::vector<const ObstacleIndex::Obstacle*>
 ObstacleIndex::getObstructingObstacles(const Position& a, const Position& b) const
 {
@@ -7,6 +7,7 @@
 #ifndef OBSTACLEINDEX_H_WKZBN6QH
 #define OBSTACLEINDEX_H_WKZBN6QH
 
+#include "artery/inet/gemv2/Wall.h"
 #include "artery/utility/Geometry.h"
 #include <boost/geometry/index/rtree.hpp>
 #include <omnetpp/ccanvas.h>
@@ -21,6 +22,9 @@ namespace traci { class API; }
 
 namespace artery
 {
+
+class PolygonDatabase;
+
 namespace gemv2
 {
 
@@ -43,6 +47,8 @@ public:
         double mArea;
     };
 
+    using Wall = gemv2::Wall;
+
     // cSimpleModule
     void initialize() override;
 
@@ -61,6 +67,31 @@ public:
      */
     std::vector<const Obstacle*> obstaclesEllipse(const Position& a, const Position& b, double range) const;
 
+    /**
+     * Get all walls of given obstacles, e.g. of those found by obstaclesEllipse
+     *
+     * \param obstacles obstacles of this index
+     * \param walls walls are appended per obstacle in outline order
+     */
+    void obstacleWalls(const std::vector<const Obstacle*>& obstacles, std::vector<const Wall*>& walls) const;
+
+    /**
+     * Get walls whose bounding box intersects a segment
+     *
+     * Exact intersection tests are left to the caller.
+     * \param a start of segment
+     * \param b end of segment
+     * \param walls found walls are appended
+     */
+    void wallsSegment(const Position& a, const Position& b, std::vector<const Wall*>& walls) const;
+
+    /**
+     * Get obstacles whose bounding box covers a point
+     * \param p point
+     * \param boxes bounding boxes along with obstacle indices are appended
+     */
+    void obstacleBoxes(const Position& p, std::vector<std::pair<geometry::Box, std::size_t>>& boxes) const;
+
     /**
      * Get all obstacles obstructing the line of sight between given points
      * \param a position a, e.g. transmitter
@@ -69,6 +100,12 @@ public:
      */
     std::vector<const Obstacle*> getObstructingObstacles(const Position& a, const Position& b) const;
 
+    /**
+     * Replace all indexed obstacles, e.g. by obstacles of a replayed link trace
+     * \param outlines valid outlines of obstacles
+     */
+    void replaceObstacles(std::vector<std::vector<Position>>&& outlines);
+
     /**
      * Get all currently indexed obstacles
      * \return obstacles
@@ -83,6 +120,10 @@ public:
 
 private:
     void fetchObstacles(const traci::API&);
+    void fetchObstacles(const PolygonDatabase&);
+    void buildRtree();
+
+    void buildWallRtree();
 
     using RtreeValue = std::pair<geometry::Box, std::size_t>;
     using Rtree = boost::geometry::index::rtree<RtreeValue, boost::geometry::index::rstar<16>>;
@@ -90,7 +131,11 @@ private:
     std::set<std::string> mFilterTypes;
     std::vector<Obstacle> mObstacles;
     Rtree mObstacleRtree;
+    std::vector<Wall> mWalls; /*< grouped by obstacle */
+    std::vector<std::size_t> mWallOffsets; /*< first wall of each obstacle, followed by number of walls */
+    Rtree mWallRtree; /*< indexes mWalls */
     Visualizer* mVisualizer = nullptr;
+    PolygonDatabase* mPolygonDatabase = nullptr;
     omnetpp::cFigure::Color mColor;
 };
 
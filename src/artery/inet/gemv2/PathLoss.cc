@@ -5,11 +5,19 @@
  */
 
 #include "artery/inet/gemv2/LinkClassifier.h"
+#include "artery/inet/gemv2/LinkTraceRecorder.h"
 #include "artery/inet/gemv2/PathLoss.h"
 #include "artery/inet/gemv2/SmallScaleVariation.h"
 #include "artery/utility/Geometry.h"
+#include "artery/utility/WorkerPool.h"
+#include <inet/common/INETMath.h>
+#include <inet/physicallayer/contract/packetlevel/IRadio.h>
 #include <omnetpp/checkandcast.h>
 #include <omnetpp/cexception.h>
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <string>
 
 namespace artery
 {
@@ -21,13 +29,79 @@ Define_Module(PathLoss)
 using namespace inet;
 namespace phy = inet::physicallayer;
 
+namespace
+{
+
+const char* getLinkClassName(LinkClass link)
+{
+    switch (link) {
+        case LinkClass::LOS:
+            return "LOS";
+        case LinkClass::NLOSb:
+            return "NLOSb";
+        case LinkClass::NLOSf:
+            return "NLOSf";
+        case LinkClass::NLOSv:
+            return "NLOSv";
+        default:
+            return "invalid";
+    }
+}
+
+// standard normal variate of a random stream, i.e. Box-Muller transform of two SplitMix64 outputs
+double drawStandardNormal(std::uint64_t seed, std::uint64_t stream)
+{
+    std::uint64_t state = seed ^ (stream * UINT64_C(0xd1b54a32d192ed03));
+    auto next = [&state]() {
+        std::uint64_t z = (state += UINT64_C(0x9e3779b97f4a7c15));
+        z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+        z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+        return z ^ (z >> 31);
+    };
+
+    const double scale = 1.0 / 9007199254740992.0; // 2^-53
+    const double u1 = ((next() >> 11) + 1) * scale; // (0, 1]
+    const double u2 = (next() >> 11) * scale; // [0, 1)
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+}
+
+// path loss models known to never draw random numbers, matched by exact NED type
+const std::set<std::string> deterministicModels = {
+    "inet.physicallayer.pathloss.FreeSpacePathLoss",
+    "inet.physicallayer.pathloss.TwoRayInterference",
+    "artery.inet.DistanceSwitchPathLoss",
+    "artery.inet.gemv2.NLOSb",
+    "artery.inet.gemv2.NLOSf",
+    "artery.inet.gemv2.NLOSv",
+};
+
+// find a model or one of its nested models not known to be deterministic
+const cModule* findRandomModel(const cModule* model)
+{
+    if (deterministicModels.count(model->getNedTypeName()) == 0) {
+        return model;
+    }
+    for (cModule::SubmoduleIterator it(model); !it.end(); ++it) {
+        if (const cModule* random = findRandomModel(*it)) {
+            return random;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
 PathLoss::PathLoss() :
     m_los(nullptr), m_nlos_b(nullptr), m_nlos_f(nullptr), m_nlos_v(nullptr),
-    m_classifier(nullptr), m_small_scale(nullptr),
+    m_classifier(nullptr), m_small_scale(nullptr), m_recorder(nullptr),
     m_range_los(NaN), m_range_nlos_b(NaN), m_range_nlos_f(NaN), m_range_nlos_v(NaN)
 {
 }
 
+PathLoss::~PathLoss()
+{
+}
+
 void PathLoss::initialize()
 {
     m_los = check_and_cast<IPathLoss*>(getSubmodule("LOS"));
@@ -36,10 +110,35 @@ void PathLoss::initialize()
     m_nlos_v = check_and_cast<IPathLoss*>(getSubmodule("NLOSv"));
     m_classifier = check_and_cast<LinkClassifier*>(getSubmodule("classifier"));
     m_small_scale = dynamic_cast<SmallScaleVariation*>(getSubmodule("smallScaleVariations"));
+    m_recorder = dynamic_cast<LinkTraceRecorder*>(getSubmodule("traceRecorder"));
     m_range_los = meter(par("rangeLOS"));
     m_range_nlos_b = meter(par("rangeNLOSb"));
     m_range_nlos_f = meter(par("rangeNLOSf"));
     m_range_nlos_v = meter(par("rangeNLOSv"));
+
+    int batchThreads = par("batchThreads");
+    if (batchThreads < 0) {
+        throw cRuntimeError("batchThreads must not be negative");
+    } else if (batchThreads != 1) {
+        if (par("withVisualization")) {
+            throw cRuntimeError("batchThreads requires withVisualization = false");
+        }
+        // models are evaluated concurrently, i.e. any RNG draws would race
+        for (const char* model : { "LOS", "NLOSb", "NLOSf", "NLOSv" }) {
+            if (const cModule* random = findRandomModel(getSubmodule(model))) {
+                throw cRuntimeError("batchThreads requires deterministic path loss models, but %s is of unsupported type %s",
+                        random->getFullPath().c_str(), random->getNedTypeName());
+            }
+        }
+        m_batch_pool.reset(new WorkerPool(batchThreads));
+        EV_INFO << "path losses are computed on " << m_batch_pool->size() << " threads\n";
+    }
+}
+
+void PathLoss::finish()
+{
+    m_batch_pool.reset();
+    m_batch_losses.clear();
 }
 
 double PathLoss::computePathLoss(const phy::ITransmission* transmission, const phy::IArrival* arrival) const
@@ -47,45 +146,124 @@ double PathLoss::computePathLoss(const phy::ITransmission* transmission, const p
     inet::Coord tx = transmission->getStartPosition();
     inet::Coord rx = arrival->getStartPosition();
 
+    if (!m_batch_losses.empty()) {
+        auto found = m_batch_losses.find(arrival);
+        if (found != m_batch_losses.end() && found->second.transmission == transmission->getId()) {
+            return found->second.loss;
+        }
+    }
+
     LinkClass link = m_classifier->classifyLink(Position { tx.x, tx.y }, Position { rx.x, rx.y });
-    IPathLoss* model = nullptr;
     meter range { 0.0 };
+    IPathLoss* model = selectModel(link, range);
+    EV_DETAIL << getLinkClassName(link) << " propagation for " << *transmission << "\n";
+
+    // compare model's maximum range with actual distance
+    if (tx.distance(rx) > range.get()) {
+        if (m_recorder) {
+            m_recorder->recordLink(transmission, tx, rx, link, 0.0, NaN);
+        }
+        return 0.0; // all signal power is lost
+    }
+
+    const double loss = model->computePathLoss(transmission, arrival);
+    double variation = 1.0;
+    double sigma = NaN;
+    if (m_small_scale) {
+        const auto deviation = m_small_scale->computeDeviation(Position { tx.x, tx.y }, Position { rx.x, rx.y }, range, link);
+        m_small_scale->recordDeviation(deviation);
+        variation = m_small_scale->drawVariation(deviation);
+        sigma = deviation.sigma;
+    }
+    if (m_recorder) {
+        m_recorder->recordLink(transmission, tx, rx, link, loss, sigma);
+    }
+    return loss * variation;
+}
+
+void PathLoss::computePathLosses(const phy::ITransmission* transmission, const std::vector<Link>& links) const
+{
+    ASSERT(m_batch_pool);
+
+    // drop results of arrivals which have ended
+    const simtime_t now = simTime();
+    for (auto it = m_batch_losses.begin(); it != m_batch_losses.end();) {
+        if (it->second.end < now) {
+            it = m_batch_losses.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    const inet::Coord tx = transmission->getStartPosition();
+    m_batch_links.clear();
+    for (const Link& link : links) {
+        const inet::Coord rx = link.arrival->getStartPosition();
+        m_batch_links.emplace_back(Position { tx.x, tx.y }, Position { rx.x, rx.y });
+    }
+    m_classifier->classifyLinks(m_batch_links, m_batch_classes, *m_batch_pool);
+
+    std::uint64_t seed = 0;
+    if (m_small_scale) {
+        seed = getRNG(0)->intRand();
+        seed = seed << 32 | getRNG(0)->intRand();
+    }
+
+    m_batch_results.resize(links.size());
+    m_batch_pool->run(links.size(), [this, transmission, &links, &tx, seed](std::size_t i) {
+        BatchResult& result = m_batch_results[i];
+        result.withDeviation = false;
+
+        meter range { 0.0 };
+        IPathLoss* model = selectModel(m_batch_classes[i], range);
+        if (tx.distance(links[i].arrival->getStartPosition()) > range.get()) {
+            result.modelLoss = 0.0;
+            result.loss = 0.0; // all signal power is lost
+            return;
+        }
+
+        result.modelLoss = model->computePathLoss(transmission, links[i].arrival);
+        result.loss = result.modelLoss;
+        if (m_small_scale) {
+            result.deviation = m_small_scale->computeDeviation(m_batch_links[i].first, m_batch_links[i].second, range, m_batch_classes[i]);
+            result.withDeviation = true;
+            const double variation = result.deviation.sigma * drawStandardNormal(seed, links[i].receiver->getId());
+            result.loss *= inet::math::dB2fraction(variation);
+        }
+    });
+
+    for (std::size_t i = 0; i < links.size(); ++i) {
+        const BatchResult& result = m_batch_results[i];
+        if (result.withDeviation) {
+            m_small_scale->recordDeviation(result.deviation);
+        }
+        if (m_recorder) {
+            m_recorder->recordLink(transmission, tx, links[i].arrival->getStartPosition(), m_batch_classes[i],
+                    result.modelLoss, result.withDeviation ? result.deviation.sigma : NaN);
+        }
+        m_batch_losses[links[i].arrival] = BatchLoss { transmission->getId(), links[i].arrival->getEndTime(), result.loss };
+    }
+}
+
+phy::IPathLoss* PathLoss::selectModel(LinkClass link, meter& range) const
+{
     switch (link)
     {
         case LinkClass::LOS:
-            model = m_los;
             range = m_range_los;
-            EV_DETAIL << "LOS propagation for " << *transmission << "\n";
-            break;
+            return m_los;
         case LinkClass::NLOSb:
-            model = m_nlos_b;
             range = m_range_nlos_b;
-            EV_DETAIL << "NLOSb propagation for " << *transmission << "\n";
-            break;
+            return m_nlos_b;
         case LinkClass::NLOSf:
-            model = m_nlos_f;
             range = m_range_nlos_f;
-            EV_DETAIL << "NLOSf propagation for " << *transmission << "\n";
-            break;
+            return m_nlos_f;
         case LinkClass::NLOSv:
-            model = m_nlos_v;
             range = m_range_nlos_v;
-            EV_DETAIL << "NLOSv propagation for " << *transmission << "\n";
-            break;
+            return m_nlos_v;
         default:
             throw cRuntimeError("invalid link classification");
     };
-
-    // compare model's maximum range with actual distance
-    if (tx.distance(rx) > range.get()) {
-        return 0.0; // all signal power is lost
-    }
-
-    double loss = model->computePathLoss(transmission, arrival);
-    if (m_small_scale) {
-        loss *= m_small_scale->computeVariation(Position { tx.x, tx.y }, Position { rx.x, rx.y }, range, link);
-    }
-    return loss;
 }
 
 double PathLoss::computePathLoss(mps, Hz, m) const
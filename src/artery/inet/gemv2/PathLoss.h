@@ -7,45 +7,119 @@
 #ifndef PATHLOSS_H_ZABKB47G
 #define PATHLOSS_H_ZABKB47G
 
+#include "artery/inet/gemv2/LinkClass.h"
+#include "artery/inet/gemv2/SmallScaleVariation.h"
+#include "artery/utility/Geometry.h"
 #include <inet/common/Units.h>
 #include <inet/physicallayer/contract/packetlevel/IPathLoss.h>
 #include <omnetpp/csimplemodule.h>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// forward declaration
+namespace inet { namespace physicallayer { class IRadio; } }
 
 namespace artery
 {
+
+// forward declaration
+class WorkerPool;
+
 namespace gemv2
 {
 
 // forward declarations
 class LinkClassifier;
-class SmallScaleVariation;
+class LinkTraceRecorder;
 
 class PathLoss : public omnetpp::cSimpleModule, public inet::physicallayer::IPathLoss
 {
 public:
+    /**
+     * Arrival of a transmission at a receiver
+     */
+    struct Link
+    {
+        const inet::physicallayer::IRadio* receiver;
+        const inet::physicallayer::IArrival* arrival;
+    };
+
     PathLoss();
+    ~PathLoss();
 
     // OMNeT++ simple module
     void initialize() override;
+    void finish() override;
 
     // INET IPathLoss interface
     double computePathLoss(const inet::physicallayer::ITransmission*, const inet::physicallayer::IArrival*) const override;
     double computePathLoss(inet::mps, inet::Hz, inet::m) const override;
     inet::m computeRange(inet::mps, inet::Hz, double loss) const override;
 
+    /**
+     * Check if path losses are computed in batches, i.e. computePathLosses is effective
+     */
+    bool isBatchEnabled() const { return static_cast<bool>(m_batch_pool); }
+
+    /**
+     * Compute path losses of all arrivals of a transmission at once
+     *
+     * Link classification, path loss models and small scale variations are evaluated in parallel.
+     * Results are picked up by subsequent computePathLoss calls for these arrivals.
+     * Small scale variations are drawn from a random stream per receiver, which is derived
+     * from a seed drawn once per transmission, i.e. results do not depend on the number of threads.
+     * Unbatched computePathLoss calls draw from the module RNG per arrival instead,
+     * thus batched and unbatched simulations yield different results.
+     * \param transmission transmission
+     * \param links arrivals of transmission at receivers
+     */
+    void computePathLosses(const inet::physicallayer::ITransmission* transmission, const std::vector<Link>& links) const;
+
+    /**
+     * Select path loss model of a link class
+     * \param link link class
+     * \param range maximum range of selected model
+     * \return path loss model
+     */
+    inet::physicallayer::IPathLoss* selectModel(LinkClass link, inet::m& range) const;
+
 private:
     using meter = inet::m;
 
+    struct BatchResult
+    {
+        double modelLoss; /*< loss of link class' model */
+        double loss;
+        bool withDeviation;
+        SmallScaleVariation::Deviation deviation;
+    };
+
+    struct BatchLoss
+    {
+        int transmission; /*< identifier of transmission */
+        omnetpp::simtime_t end; /*< end of arrival */
+        double loss;
+    };
+
     inet::physicallayer::IPathLoss* m_los;
     inet::physicallayer::IPathLoss* m_nlos_b;
     inet::physicallayer::IPathLoss* m_nlos_f;
     inet::physicallayer::IPathLoss* m_nlos_v;
     LinkClassifier* m_classifier;
     SmallScaleVariation* m_small_scale;
+    LinkTraceRecorder* m_recorder;
     meter m_range_los;
     meter m_range_nlos_b;
     meter m_range_nlos_f;
     meter m_range_nlos_v;
+
+    std::unique_ptr<WorkerPool> m_batch_pool;
+    mutable std::unordered_map<const inet::physicallayer::IArrival*, BatchLoss> m_batch_losses;
+    mutable std::vector<std::pair<Position, Position>> m_batch_links;
+    mutable std::vector<LinkClass> m_batch_classes;
+    mutable std::vector<BatchResult> m_batch_results;
 };
 
 } // namespace gemv2
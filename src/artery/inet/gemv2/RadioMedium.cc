@@ -0,0 +1,50 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/RadioMedium.h"
+#include <inet/physicallayer/contract/packetlevel/IRadio.h>
+
+namespace artery
+{
+namespace gemv2
+{
+
+Define_Module(RadioMedium)
+
+namespace phy = inet::physicallayer;
+
+void RadioMedium::initialize(int stage)
+{
+    phy::RadioMedium::initialize(stage);
+    if (stage == inet::INITSTAGE_LOCAL) {
+        mPathLoss = dynamic_cast<const PathLoss*>(getPathLoss());
+        if (!mPathLoss) {
+            EV_WARN << "path loss is not GEMV2, arrivals are not batched\n";
+        }
+    }
+}
+
+void RadioMedium::addTransmission(const phy::IRadio* transmitter, const phy::ITransmission* transmission)
+{
+    // arrivals at all radios are computed and cached by INET's radio medium
+    phy::RadioMedium::addTransmission(transmitter, transmission);
+
+    if (mPathLoss && mPathLoss->isBatchEnabled()) {
+        mLinks.clear();
+        communicationCache->mapRadios([this, transmitter, transmission](const phy::IRadio* receiver) {
+            if (receiver && receiver != transmitter) {
+                const phy::IArrival* arrival = communicationCache->getCachedArrival(receiver, transmission);
+                if (arrival) {
+                    mLinks.push_back(PathLoss::Link { receiver, arrival });
+                }
+            }
+        });
+        mPathLoss->computePathLosses(transmission, mLinks);
+    }
+}
+
+} // namespace gemv2
+} // namespace artery
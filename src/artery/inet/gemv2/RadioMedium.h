@@ -0,0 +1,40 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_RADIOMEDIUM_H_P7LQ2VXM
+#define ARTERY_GEMV2_RADIOMEDIUM_H_P7LQ2VXM
+
+#include "artery/inet/gemv2/PathLoss.h"
+#include <inet/physicallayer/common/packetlevel/RadioMedium.h>
+#include <vector>
+
+namespace artery
+{
+namespace gemv2
+{
+
+/**
+ * RadioMedium hands all arrivals of a new transmission to GEMV2's path loss at once.
+ *
+ * Path losses are thus computed in a batch (and in parallel) right after arrivals have been
+ * computed instead of one by one when INET computes each reception.
+ * Without batch-enabled GEMV2 path loss this medium behaves like INET's radio medium.
+ */
+class RadioMedium : public inet::physicallayer::RadioMedium
+{
+protected:
+    void initialize(int stage) override;
+    void addTransmission(const inet::physicallayer::IRadio*, const inet::physicallayer::ITransmission*) override;
+
+private:
+    const PathLoss* mPathLoss = nullptr;
+    std::vector<PathLoss::Link> mLinks;
+};
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_RADIOMEDIUM_H_P7LQ2VXM */
@@ -10,6 +10,10 @@
 #include <artery/inet/gemv2/VehicleIndex.h>
 #include <inet/common/INETMath.h>
 #include <inet/common/ModuleAccess.h>
+#include <omnetpp/checkandcast.h>
+#include <traci/API.h>
+#include <traci/BasicNodeManager.h>
+#include <traci/Boundary.h>
 #include <cmath>
 #include <limits>
 #include <numeric>
@@ -27,6 +31,18 @@ void SmallScaleVariation::initialize()
     mObstacleIndex = inet::findModuleFromPar<ObstacleIndex>(par("obstacleIndexModule"), this);
     mVehicleIndex = inet::findModuleFromPar<VehicleIndex>(par("vehicleIndexModule"), this);
 
+    mRasterCellSize = par("densityRasterCellSize");
+    if (mRasterCellSize < 0.0) {
+        throw omnetpp::cRuntimeError("densityRasterCellSize must not be negative");
+    } else if (mRasterCellSize > 0.0) {
+        omnetpp::cModule* traci = getModuleByPath(par("traciModule"));
+        if (traci) {
+            traci->subscribe(traci::BasicNodeManager::updateNodeSignal, this);
+        } else {
+            throw omnetpp::cRuntimeError("No TraCI module found for signal subscription");
+        }
+    }
+
     // Minimum stddev of small scale variation
     mMinStdDevLOS = par("minStdDevLOS");
     mMinStdDevNLOSv = par("minStdDevNLOSv");
@@ -62,7 +78,72 @@ void SmallScaleVariation::finish()
     recordScalar("maxObstacleDensity", mMaxObservedObstacleDensity);
 }
 
+void SmallScaleVariation::receiveSignal(omnetpp::cComponent* source, omnetpp::simsignal_t signal, unsigned long, omnetpp::cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traci::BasicNodeManager::updateNodeSignal) {
+        updateRasters(source);
+    }
+}
+
+void SmallScaleVariation::updateRasters(omnetpp::cComponent* source)
+{
+    double width = 0.0;
+    double height = 0.0;
+    if (mObstacleRaster.empty()) {
+        auto api = omnetpp::check_and_cast<traci::NodeManager*>(source)->getAPI();
+        ASSERT(api);
+        const traci::Boundary boundary { api->simulation.getNetBoundary() };
+        width = boundary.upperRightPosition().x - boundary.lowerLeftPosition().x;
+        height = boundary.upperRightPosition().y - boundary.lowerLeftPosition().y;
+    }
+    updateRasters(width, height);
+}
+
+void SmallScaleVariation::updateRasters(double width, double height)
+{
+    if (mRasterCellSize <= 0.0) {
+        return;
+    }
+
+    if (mObstacleRaster.empty()) {
+        // obstacles are static: rasterize them once, i.e. after obstacle index has been populated
+        mObstacleRaster.reset(width, height, mRasterCellSize);
+        mVehicleRaster.reset(width, height, mRasterCellSize);
+
+        for (const ObstacleIndex::Obstacle& obstacle : mObstacleIndex->getObstacles()) {
+            mObstacleRaster.add(obstacle.getCentroid(), obstacle.getArea());
+        }
+        mObstacleRaster.build();
+    }
+
+    mVehicleRaster.clear();
+    for (const auto& vehicle : mVehicleIndex->getVehicles()) {
+        mVehicleRaster.add(vehicle.second.getMidpoint());
+    }
+    mVehicleRaster.build();
+}
+
 double SmallScaleVariation::computeVariation(const Position& a, const Position& b, m range, LinkClass link) const
+{
+    const Deviation deviation = computeDeviation(a, b, range, link);
+    recordDeviation(deviation);
+    return drawVariation(deviation);
+}
+
+double SmallScaleVariation::computeVariation(const Position& a, const Position& b, m range, double minDev, double maxDev) const
+{
+    const Deviation deviation = computeDeviation(a, b, range, minDev, maxDev);
+    recordDeviation(deviation);
+    return drawVariation(deviation);
+}
+
+double SmallScaleVariation::drawVariation(const Deviation& deviation) const
+{
+    return inet::math::dB2fraction(normal(0.0, deviation.sigma));
+}
+
+auto SmallScaleVariation::computeDeviation(const Position& a, const Position& b, m range, LinkClass link) const -> Deviation
 {
     double minDev = 0.0;
     double maxDev = 0.0;
@@ -89,37 +170,50 @@ double SmallScaleVariation::computeVariation(const Position& a, const Position&
             break;
     }
 
-    return computeVariation(a, b, range, minDev, maxDev);
+    return computeDeviation(a, b, range, minDev, maxDev);
 }
 
-double SmallScaleVariation::computeVariation(const Position& a, const Position& b, m range, double minDev, double maxDev) const
+auto SmallScaleVariation::computeDeviation(const Position& a, const Position& b, m range, double minDev, double maxDev) const -> Deviation
 {
     using Obstacle = ObstacleIndex::Obstacle;
     using Vehicle = VehicleIndex::Vehicle;
-    std::vector<const Obstacle*> obstacles = mObstacleIndex->obstaclesEllipse(a, b, range.get());
-    std::vector<const Vehicle*> vehicles = mVehicleIndex->vehiclesEllipse(a, b, range.get());
-
-    // Calculate relative vehicle density: number of vehicles divided by squared effective range
-    const double relVehDensity = vehicles.size() / squared(range.get());
-    if (relVehDensity > mMaxObservedVehicleDensity) {
-        mMaxObservedVehicleDensity = relVehDensity;
+    double numVehicles = 0.0;
+    double obsTotalArea = 0.0;
+
+    if (!mVehicleRaster.empty()) {
+        numVehicles = mVehicleRaster.sumEllipse(a, b, range.get());
+        obsTotalArea = mObstacleRaster.sumEllipse(a, b, range.get());
+    } else {
+        std::vector<const Obstacle*> obstacles = mObstacleIndex->obstaclesEllipse(a, b, range.get());
+        std::vector<const Vehicle*> vehicles = mVehicleIndex->vehiclesEllipse(a, b, range.get());
+        numVehicles = vehicles.size();
+        obsTotalArea = std::accumulate(obstacles.begin(), obstacles.end(), 0.0,
+                [](double accu, const Obstacle* obs) {
+                    return accu + obs->getArea();
+                });
     }
 
+    Deviation deviation;
+    // Calculate relative vehicle density: number of vehicles divided by squared effective range
+    deviation.vehicleDensity = numVehicles / squared(range.get());
     // Calculate relative obstacle density: area covered by obstacles divided by squared range
-    const double obsTotalArea = std::accumulate(obstacles.begin(), obstacles.end(), 0.0,
-            [](double accu, const Obstacle* obs) {
-                return accu + obs->getArea();
-            });
-    const double relObsDensity = obsTotalArea / squared(range.get());
-    if (relObsDensity > mMaxObservedObstacleDensity) {
-        mMaxObservedObstacleDensity = relObsDensity;
-    }
+    deviation.obstacleDensity = obsTotalArea / squared(range.get());
 
     // Calculate the vehicle density coefficient and static density coefficient
-    const double vehDensityCoeff = std::min(1.0, sqrt(relVehDensity / mMaxVehicleDensity));
-    const double obsDensityCoeff = std::min(1.0, sqrt(relObsDensity / mMaxObstacleDensity));
-    const double deviation = minDev + 0.5 * (maxDev - minDev) * (vehDensityCoeff + obsDensityCoeff);
-    return inet::math::dB2fraction(normal(0.0, deviation));
+    const double vehDensityCoeff = std::min(1.0, sqrt(deviation.vehicleDensity / mMaxVehicleDensity));
+    const double obsDensityCoeff = std::min(1.0, sqrt(deviation.obstacleDensity / mMaxObstacleDensity));
+    deviation.sigma = minDev + 0.5 * (maxDev - minDev) * (vehDensityCoeff + obsDensityCoeff);
+    return deviation;
+}
+
+void SmallScaleVariation::recordDeviation(const Deviation& deviation) const
+{
+    if (deviation.vehicleDensity > mMaxObservedVehicleDensity) {
+        mMaxObservedVehicleDensity = deviation.vehicleDensity;
+    }
+    if (deviation.obstacleDensity > mMaxObservedObstacleDensity) {
+        mMaxObservedObstacleDensity = deviation.obstacleDensity;
+    }
 }
 
 } // namespace gemv2
@@ -7,8 +7,10 @@
 #ifndef SMALL_SCALE_H
 #define SMALL_SCALE_H
 
+#include "artery/inet/gemv2/DensityRaster.h"
 #include "artery/inet/gemv2/LinkClass.h"
 #include "inet/common/Units.h"
+#include <omnetpp/clistener.h>
 #include <omnetpp/csimplemodule.h>
 
 
@@ -24,21 +26,74 @@ namespace gemv2
 class ObstacleIndex;
 class VehicleIndex;
 
-class SmallScaleVariation : public omnetpp::cSimpleModule
+/**
+ * SmallScaleVariation derives the deviation of small scale fading from the
+ * vehicle and obstacle densities within the ellipse spanned by transmitter and receiver.
+ *
+ * Densities are either computed by exact ellipse queries per link or looked up in
+ * density rasters: obstacle areas are rasterized once, vehicle counts at each TraCI step.
+ */
+class SmallScaleVariation : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
 public:
    using m = inet::units::values::m;
 
    void initialize() override;
    void finish() override;
+   void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, unsigned long, omnetpp::cObject*) override;
+
+   /**
+    * Densities within the ellipse of a link and the resulting deviation of small scale variation
+    */
+   struct Deviation
+   {
+      double sigma = 0.0; /*< standard deviation [dB] */
+      double vehicleDensity = 0.0; /*< relative vehicle density */
+      double obstacleDensity = 0.0; /*< relative obstacle density */
+   };
 
    double computeVariation(const Position& a, const Position& b, m range, LinkClass link) const;
    double computeVariation(const Position& a, const Position& b, m range, double minSD, double maxSD) const;
 
+   /**
+    * Compute deviation without drawing a random variation
+    *
+    * This method does not modify any state, i.e. it is safe to call from several threads
+    * as long as vehicle and obstacle indices remain unchanged.
+    */
+   Deviation computeDeviation(const Position& a, const Position& b, m range, LinkClass link) const;
+   Deviation computeDeviation(const Position& a, const Position& b, m range, double minSD, double maxSD) const;
+
+   /**
+    * Track observed densities of a deviation for statistics
+    */
+   void recordDeviation(const Deviation&) const;
+
+   /**
+    * Draw small scale variation of a deviation from this module's random stream
+    * \return loss factor
+    */
+   double drawVariation(const Deviation&) const;
+
+   /**
+    * Update density rasters from current vehicle and obstacle indices
+    *
+    * This is done at each TraCI node update automatically if rasters are enabled.
+    * \param width width of road network [m]
+    * \param height height of road network [m]
+    */
+   void updateRasters(double width, double height);
+
 private:
+   void updateRasters(omnetpp::cComponent* source);
+
    const ObstacleIndex* mObstacleIndex;
    const VehicleIndex* mVehicleIndex;
 
+   double mRasterCellSize = 0.0; /*< 0 disables density rasters */
+   DensityRaster mObstacleRaster; /*< obstacle areas at their centroids */
+   DensityRaster mVehicleRaster; /*< vehicle counts at their midpoints */
+
    double mMaxVehicleDensity;
    double mMaxObstacleDensity;
    mutable double mMaxObservedVehicleDensity;
@@ -0,0 +1,165 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/StaticVisibilityRaster.h"
+#include "artery/traci/PolygonCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace artery
+{
+namespace gemv2
+{
+
+namespace
+{
+
+const char cacheMagic[8] = { 'A', 'R', 'T', 'V', 'I', 'S', '\0', '\0' };
+const std::uint32_t cacheVersion = 1;
+
+struct CacheHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+    std::uint64_t key;
+    std::uint64_t numRasters;
+};
+
+struct CacheRecord
+{
+    double siteX;
+    double siteY;
+    std::uint64_t columns;
+};
+
+static_assert(sizeof(CacheHeader) == 32, "unexpected padding of cache header");
+static_assert(sizeof(CacheRecord) == 24, "unexpected padding of cache record");
+
+// file layout: header, then each raster's record followed by its cells (one byte each)
+
+} // namespace
+
+constexpr std::size_t StaticVisibilityRaster::npos;
+
+StaticVisibilityRaster::StaticVisibilityRaster(const Position& site, double range, double cellSize) :
+    mSite(site), mCellSize(cellSize)
+{
+    if (cellSize <= 0.0) {
+        throw std::invalid_argument("cell size of visibility raster has to be positive");
+    }
+
+    // odd number of columns: site is located at centre of the middle cell
+    const std::size_t half = static_cast<std::size_t>(std::ceil(std::max(range, 0.0) / cellSize));
+    mColumns = 2 * half + 1;
+    mOriginX = site.x.value() - (half + 0.5) * cellSize;
+    mOriginY = site.y.value() - (half + 0.5) * cellSize;
+    mCells.assign(mColumns * mColumns, Cell::Unknown);
+}
+
+std::size_t StaticVisibilityRaster::getCellIndex(const Position& pos) const
+{
+    const double column = std::floor((pos.x.value() - mOriginX) / mCellSize);
+    const double row = std::floor((pos.y.value() - mOriginY) / mCellSize);
+    if (column < 0.0 || row < 0.0 || column >= mColumns || row >= mColumns) {
+        return npos;
+    }
+    return static_cast<std::size_t>(row) * mColumns + static_cast<std::size_t>(column);
+}
+
+Position StaticVisibilityRaster::getCellCentre(std::size_t index) const
+{
+    const std::size_t column = index % mColumns;
+    const std::size_t row = index / mColumns;
+    return Position { mOriginX + (column + 0.5) * mCellSize, mOriginY + (row + 0.5) * mCellSize };
+}
+
+bool readVisibilityCache(const std::string& path, const PolygonCacheKey& key, double range, double cellSize,
+        std::vector<StaticVisibilityRaster>& rasters)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    CacheHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+        header.version != cacheVersion || header.key != key.value()) {
+        return false;
+    }
+
+    std::vector<StaticVisibilityRaster> result;
+    for (std::uint64_t i = 0; i < header.numRasters; ++i) {
+        CacheRecord record;
+        if (!file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+            return false;
+        }
+
+        result.emplace_back(Position { record.siteX, record.siteY }, range, cellSize);
+        std::vector<StaticVisibilityRaster::Cell>& cells = result.back().getCells();
+        if (record.columns != result.back().getColumns() ||
+            !file.read(reinterpret_cast<char*>(cells.data()), cells.size())) {
+            return false;
+        }
+
+        for (StaticVisibilityRaster::Cell& cell : cells) {
+            if (cell > StaticVisibilityRaster::Cell::NLOSf) {
+                return false;
+            }
+        }
+    }
+
+    if (file.peek() != std::ifstream::traits_type::eof()) {
+        return false;
+    }
+
+    rasters.insert(rasters.end(), result.begin(), result.end());
+    return true;
+}
+
+bool writeVisibilityCache(const std::string& path, const std::string& tmpSuffix, const PolygonCacheKey& key,
+        const std::vector<StaticVisibilityRaster>& rasters)
+{
+    CacheHeader header;
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version = cacheVersion;
+    header.reserved = 0;
+    header.key = key.value();
+    header.numRasters = rasters.size();
+
+    const std::string tmpPath = path + tmpSuffix;
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const StaticVisibilityRaster& raster : rasters) {
+            CacheRecord record;
+            record.siteX = raster.getSite().x.value();
+            record.siteY = raster.getSite().y.value();
+            record.columns = raster.getColumns();
+            file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            file.write(reinterpret_cast<const char*>(raster.getCells().data()), raster.getCells().size());
+        }
+
+        if (!file) {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace gemv2
+} // namespace artery
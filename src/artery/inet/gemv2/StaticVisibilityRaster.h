@@ -0,0 +1,107 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_STATICVISIBILITYRASTER_H_H3RW8ZTE
+#define ARTERY_GEMV2_STATICVISIBILITYRASTER_H_H3RW8ZTE
+
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace artery
+{
+
+// forward declaration
+class PolygonCacheKey;
+
+namespace gemv2
+{
+
+/**
+ * StaticVisibilityRaster stores the static link classes of a fixed site, e.g. a road-side unit.
+ *
+ * The raster is a square grid of cells centred at the site. Each cell holds the classification
+ * of the link between site and cell centre considering only static geometry, i.e. buildings and foliage.
+ * Cells are classified on demand, thus cells start as unknown.
+ */
+class StaticVisibilityRaster
+{
+public:
+    enum class Cell : std::uint8_t { Unknown, LOS, NLOSb, NLOSf };
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * Create raster with unknown cells
+     * \param site position of static node
+     * \param range covered distance from site along x and y axis [m]
+     * \param cellSize edge length of a cell [m]
+     */
+    StaticVisibilityRaster(const Position& site, double range, double cellSize);
+
+    const Position& getSite() const { return mSite; }
+    std::size_t getColumns() const { return mColumns; }
+
+    /**
+     * Get index of cell containing position
+     * \param pos position
+     * \return cell index or npos if position is not covered by raster
+     */
+    std::size_t getCellIndex(const Position& pos) const;
+
+    /**
+     * Get centre of cell
+     * \param index cell index
+     * \return centre position
+     */
+    Position getCellCentre(std::size_t index) const;
+
+    Cell getCell(std::size_t index) const { return mCells[index]; }
+    void setCell(std::size_t index, Cell cell) { mCells[index] = cell; }
+
+    std::vector<Cell>& getCells() { return mCells; }
+    const std::vector<Cell>& getCells() const { return mCells; }
+
+private:
+    Position mSite;
+    double mCellSize;
+    double mOriginX; /*< x coordinate of raster's lower left corner */
+    double mOriginY; /*< y coordinate of raster's lower left corner */
+    std::size_t mColumns; /*< number of columns and rows */
+    std::vector<Cell> mCells;
+};
+
+/**
+ * Read visibility rasters from a binary cache file
+ * \param path cache file
+ * \param key expected key of static geometry and raster dimensions
+ * \param range expected range of rasters
+ * \param cellSize expected cell size of rasters
+ * \param rasters destination, read rasters are appended on success only
+ * \return true if cache file exists, is intact and matches the key
+ */
+bool readVisibilityCache(const std::string& path, const PolygonCacheKey& key, double range, double cellSize,
+        std::vector<StaticVisibilityRaster>& rasters);
+
+/**
+ * Write visibility rasters to a binary cache file
+ *
+ * The file is written to a temporary file first and renamed afterwards.
+ * \param path cache file
+ * \param tmpSuffix suffix of temporary file, unique among concurrent writers
+ * \param key key of static geometry and raster dimensions
+ * \param rasters rasters to store
+ * \return true on success
+ */
+bool writeVisibilityCache(const std::string& path, const std::string& tmpSuffix, const PolygonCacheKey& key,
+        const std::vector<StaticVisibilityRaster>& rasters);
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_STATICVISIBILITYRASTER_H_H3RW8ZTE */
@@ -12,7 +12,6 @@
 #include "traci/API.h"
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/register/linestring.hpp>
-#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/units/cmath.hpp>
@@ -20,6 +19,7 @@
 #include <omnetpp/checkandcast.h>
 #include <algorithm>
 #include <array>
+#include <cmath>
 
 namespace { using LineOfSight = std::array<artery::Position, 2>; }
 BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
@@ -60,14 +60,7 @@ void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, unsigne
 {
     Enter_Method_Silent();
     if (signal == traci::BasicNodeManager::updateNodeSignal) {
-        using Indexable = typename RtreeValue::first_type;
-        using Iterator = typename RtreeValue::second_type;
-        mVehicleRtree.clear();
-        for (Iterator it = mVehicles.begin(); it != mVehicles.end(); ++it) {
-            const Vehicle& vehicle = it->second;
-            mVehicleRtree.insert(RtreeValue { bg::return_envelope<Indexable>(vehicle.getOutline()), it });
-        }
-        mRtreeTainted = false;
+        buildRtree();
         if (mVisualizer) {
             mVisualizer->drawVehicles(this);
         }
@@ -83,6 +76,7 @@ void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, const c
         Vehicle vehicle(*api, id, mVehicleMargin);
         auto insertion = mVehicles.emplace(id, std::move(vehicle));
         if (insertion.second) {
+            // vehicles added at TraCI initialisation are not followed by a node update
             const Vehicle& vehicle = insertion.first->second;
             RtreeValue value {
                 bg::return_envelope<RtreeValue::first_type>(vehicle.getOutline()),
@@ -99,6 +93,25 @@ void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, const c
     }
 }
 
+void VehicleIndex::replaceVehicles(VehicleMap&& vehicles)
+{
+    mVehicles = std::move(vehicles);
+    buildRtree();
+}
+
+void VehicleIndex::buildRtree()
+{
+    // packing algorithm of bulk loading yields a better tree than one-by-one insertion
+    using Indexable = typename RtreeValue::first_type;
+    mRtreeValues.clear();
+    mRtreeValues.reserve(mVehicles.size());
+    for (auto it = mVehicles.cbegin(); it != mVehicles.cend(); ++it) {
+        mRtreeValues.emplace_back(bg::return_envelope<Indexable>(it->second.getOutline()), it);
+    }
+    mVehicleRtree = Rtree(mRtreeValues.begin(), mRtreeValues.end());
+    mRtreeTainted = false;
+}
+
 bool VehicleIndex::anyBlockage(const Position& a, const Position& b) const
 {
     ASSERT(!mRtreeTainted && mVehicles.size() == mVehicleRtree.size());
@@ -128,8 +141,14 @@ bool VehicleIndex::anyBlockage(const Position& a, const Position& b, double heig
 std::vector<const VehicleIndex::Vehicle*>
 VehicleIndex::getObstructingVehicles(const Position& a, const Position& b) const
 {
-    ASSERT(!mRtreeTainted);
     std::vector<const Vehicle*> result;
+    getObstructingVehicles(a, b, result);
+    return result;
+}
+
+void VehicleIndex::getObstructingVehicles(const Position& a, const Position& b, std::vector<const Vehicle*>& result) const
+{
+    ASSERT(!mRtreeTainted);
     const LineOfSight los { a, b };
     auto rtree_intersect = bg::index::intersects(los);
     for (auto it = mVehicleRtree.qbegin(rtree_intersect); it != mVehicleRtree.qend(); ++it) {
@@ -138,7 +157,6 @@ VehicleIndex::getObstructingVehicles(const Position& a, const Position& b) const
             result.push_back(&vehicle);
         }
     }
-    return result;
 }
 
 VehicleIndex::Vehicle::Vehicle(const traci::API& api, const std::string& id, double margin) :
@@ -150,6 +168,11 @@ VehicleIndex::Vehicle::Vehicle(const traci::API& api, const std::string& id, dou
     update(api.vehicle.getPosition(id), traci::TraCIAngle { api.vehicle.getAngle(id) });
 }
 
+VehicleIndex::Vehicle::Vehicle(const std::vector<Position>& outline, const Position& midpoint, double height) :
+    mHeight(height), mWorldMidpoint(midpoint), mWorldOutline(outline)
+{
+}
+
 void VehicleIndex::Vehicle::update(const traci::TraCIPosition& pos, traci::TraCIAngle heading)
 {
     mPosition = traci::position_cast(mBoundary, pos);
@@ -167,24 +190,28 @@ void VehicleIndex::Vehicle::createLocalOutline(double width, double length, doub
         Position(-(length + margin), 0.5 * width + margin)
     });
     mLocalMidpoint = Position { -0.5 * length, 0.0 };
+    ASSERT(bg::is_valid(mLocalOutline));
 }
 
 void VehicleIndex::Vehicle::calculateWorldOutline()
 {
-    using namespace boost::geometry::strategy::transform;
-    std::vector<Position> tmp;
-    mWorldOutline.clear();
+    // clockwise rotation by heading (like boost's rotate_transformer) followed by translation
+    const double c = std::cos(mHeading.radian());
+    const double s = std::sin(mHeading.radian());
+    const double ox = mPosition.x.value();
+    const double oy = mPosition.y.value();
+    auto transform = [c, s, ox, oy](const Position& local) {
+        const double x = local.x.value();
+        const double y = local.y.value();
+        return Position { c * x + s * y + ox, -s * x + c * y + oy };
+    };
 
-    rotate_transformer<boost::geometry::radian, double, 2, 2> rot(mHeading.radian());
-    translate_transformer<double, 2, 2> mov(mPosition.x.value(), mPosition.y.value());
-    boost::geometry::transform(mLocalOutline, tmp, rot);
-    boost::geometry::transform(tmp, mWorldOutline, mov);
-    tmp.resize(1);
-    boost::geometry::transform(mLocalMidpoint, tmp.front(), rot);
-    boost::geometry::transform(tmp.front(), mWorldMidpoint, mov);
-
-    ASSERT(mWorldOutline.size() == mLocalOutline.size());
-    ASSERT(bg::is_valid(mWorldOutline));
+    // rigid transformation keeps the valid local outline valid, no need for checks here
+    mWorldOutline.resize(mLocalOutline.size());
+    for (std::size_t i = 0; i < mLocalOutline.size(); ++i) {
+        mWorldOutline[i] = transform(mLocalOutline[i]);
+    }
+    mWorldMidpoint = transform(mLocalMidpoint);
 }
 
 std::vector<const VehicleIndex::Vehicle*>
@@ -35,6 +35,13 @@ public:
     {
     public:
         Vehicle(const traci::API&, const std::string& id, double margin = 0.0);
+
+        /**
+         * Create vehicle with a fixed world outline, e.g. from a replayed link trace.
+         * Such vehicles cannot be updated.
+         */
+        Vehicle(const std::vector<Position>& outline, const Position& midpoint, double height);
+
         void update(const traci::TraCIPosition& pos, traci::TraCIAngle heading);
         const std::vector<Position>& getOutline() const { return mWorldOutline; }
         const double getHeight() const { return mHeight; }
@@ -72,6 +79,14 @@ public:
      */
     std::vector<const Vehicle*> getObstructingVehicles(const Position& a, const Position& b) const;
 
+    /**
+     * Get all vehicles obstructing the line of sight between given points
+     * \param a position a, e.g. transmitter
+     * \param b position b, e.g. receiver
+     * \param result obstructing vehicles are appended, i.e. caller can reuse its buffer
+     */
+    void getObstructingVehicles(const Position& a, const Position& b, std::vector<const Vehicle*>& result) const;
+
     /**
      * Get vehicles with their center point being within the defined ellipse.
      *
@@ -96,15 +111,23 @@ public:
      */
     const std::map<std::string, Vehicle>& getVehicles() const { return mVehicles; }
 
+    /**
+     * Replace all indexed vehicles, e.g. by a vehicle snapshot of a replayed link trace
+     * \param vehicles map of vehicles
+     */
+    void replaceVehicles(std::map<std::string, Vehicle>&& vehicles);
+
 private:
     using VehicleMap = std::map<std::string, Vehicle>;
     using RtreeValue = std::pair<geometry::Box, VehicleMap::const_iterator>;
     using Rtree = boost::geometry::index::rtree<RtreeValue, boost::geometry::index::rstar<16>>;
 
     void vehiclesEllipse(const Position& a, const Position& b, double r, std::function<void(const Vehicle&)>) const;
+    void buildRtree();
 
     VehicleMap mVehicles;
     Rtree mVehicleRtree;
+    std::vector<RtreeValue> mRtreeValues; /*< buffer for bulk loading */
     bool mRtreeTainted = false;
     Visualizer* mVisualizer = nullptr;
     double mVehicleMargin = 0.0;
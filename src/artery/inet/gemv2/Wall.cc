@@ -0,0 +1,64 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/inet/gemv2/Wall.h"
+#include <boost/geometry/views/closeable_view.hpp>
+#include <cmath>
+#include <iterator>
+
+namespace artery
+{
+namespace gemv2
+{
+
+void appendWalls(const std::vector<Position>& outline, std::size_t obstacle, std::vector<Wall>& walls)
+{
+    namespace bg = boost::geometry;
+    using View = bg::closeable_view<const std::vector<Position>, bg::closure<std::vector<Position>>::value>::type;
+
+    View view(outline);
+    for (auto a = view.begin(), b = std::next(a); a != view.end() && b != view.end(); ++a, ++b) {
+        const double dx = b->x.value() - a->x.value();
+        const double dy = b->y.value() - a->y.value();
+        const double length = std::sqrt(dx * dx + dy * dy);
+        if (length > 0.0) {
+            Wall wall { *a, *b, dy / length, -dx / length, 0.0, obstacle };
+            wall.c = wall.nx * a->x.value() + wall.ny * a->y.value();
+            walls.push_back(wall);
+        }
+    }
+}
+
+bool reflectAtWall(const Wall& wall, const Position& tx, const Position& rx, Position& reflection)
+{
+    // no valid reflection possible if Tx and Rx are on opposite sides of wall
+    const double distTx = wall.distance(tx);
+    const double distRx = wall.distance(rx);
+    if (distTx * distRx <= 0.0) {
+        return false;
+    }
+
+    // reflection point is the intersection of wall and ray from Tx to mirror point Rx'
+    const double t = distTx / (distTx + distRx);
+    const double rxMirrorX = rx.x.value() - 2.0 * distRx * wall.nx;
+    const double rxMirrorY = rx.y.value() - 2.0 * distRx * wall.ny;
+    const double px = tx.x.value() + t * (rxMirrorX - tx.x.value());
+    const double py = tx.y.value() + t * (rxMirrorY - tx.y.value());
+
+    // reflection point has to be located on wall segment
+    const double wx = wall.b.x.value() - wall.a.x.value();
+    const double wy = wall.b.y.value() - wall.a.y.value();
+    const double u = ((px - wall.a.x.value()) * wx + (py - wall.a.y.value()) * wy) / (wx * wx + wy * wy);
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+
+    reflection = Position { px, py };
+    return true;
+}
+
+} // namespace gemv2
+} // namespace artery
@@ -0,0 +1,57 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_GEMV2_WALL_H_K4RZP8GE
+#define ARTERY_GEMV2_WALL_H_K4RZP8GE
+
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+namespace gemv2
+{
+
+/**
+ * Wall is a single edge of an obstacle's outline
+ */
+struct Wall
+{
+    Position a;
+    Position b;
+    double nx, ny; /*< unit normal of wall */
+    double c; /*< line equation: nx * x + ny * y = c */
+    std::size_t obstacle; /*< index of obstacle owning this wall */
+
+    /**
+     * Signed distance of point to wall's line
+     */
+    double distance(const Position& p) const { return nx * p.x.value() + ny * p.y.value() - c; }
+};
+
+/**
+ * Append walls of an obstacle outline, i.e. one wall per edge of non-zero length
+ * \param outline obstacle outline
+ * \param obstacle index of obstacle owning the outline
+ * \param walls walls are appended in outline order
+ */
+void appendWalls(const std::vector<Position>& outline, std::size_t obstacle, std::vector<Wall>& walls);
+
+/**
+ * Find point of specular reflection at a wall
+ * \param wall reflecting wall
+ * \param tx transmitter position
+ * \param rx receiver position
+ * \param reflection reflection point if found
+ * \return true if tx and rx are on the same side of the wall and the reflection point is on the wall
+ */
+bool reflectAtWall(const Wall& wall, const Position& tx, const Position& rx, Position& reflection);
+
+} // namespace gemv2
+} // namespace artery
+
+#endif /* ARTERY_GEMV2_WALL_H_K4RZP8GE */
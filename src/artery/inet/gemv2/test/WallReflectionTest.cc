@@ -0,0 +1,218 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+/**
+ * Compare NLOSb building reflections at precomputed walls with the former outline scan
+ *
+ * Obstacles are selected by their centroid being within the Tx/Rx ellipse, as done by
+ * ObstacleIndex::obstaclesEllipse. The former scan mirrors Rx at every edge of the selected
+ * obstacles and intersects the mirrored ray with that edge. Walls have to yield the same
+ * reflection points in the same order. Besides small buildings, the scene contains large
+ * buildings straddling the ellipse, i.e. with reflecting walls beyond the ellipse's bounding box.
+ */
+
+#include "artery/inet/gemv2/Wall.h"
+#include "artery/utility/Geometry.h"
+#include <boost/geometry.hpp>
+#include <boost/geometry/views/closeable_view.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using artery::Position;
+using artery::gemv2::Wall;
+namespace bg = boost::geometry;
+
+using PositionSegment = bg::model::segment<Position>;
+using PositionRange = std::vector<Position>;
+using PositionView = bg::closeable_view<const PositionRange, bg::closure<PositionRange>::value>::type;
+
+const double range = 300.0; /*< NLOSb's default maximum range */
+
+struct Result
+{
+    std::size_t links = 0;
+    std::size_t reflections = 0;
+    std::size_t beyondBox = 0; /*< reflections at walls missing the ellipse's bounding box */
+    std::size_t mismatches = 0;
+    double maxDeviation = 0.0;
+};
+
+double squaredLength(const Position& a, const Position& b)
+{
+    const double dx = a.x.value() - b.x.value();
+    const double dy = a.y.value() - b.y.value();
+    return dx * dx + dy * dy;
+}
+
+Position reflectPoint(const Position& p, const PositionSegment& line)
+{
+    double dx = bg::get<1, 0>(line) - bg::get<0, 0>(line);
+    double dy = bg::get<1, 1>(line) - bg::get<0, 1>(line);
+    double a = (dx * dx - dy * dy) / (dx * dx + dy * dy);
+    double b = 2.0 * dx * dy / (dx * dx + dy * dy);
+    Position q;
+    q.x = a * (p.x - line.first.x) + b * (p.y - line.first.y) + line.first.x;
+    q.y = b * (p.x - line.first.x) - a * (p.y - line.first.y) + line.first.y;
+    return q;
+}
+
+// reflection points as computed by NLOSb before walls were precomputed
+std::vector<Position> scanOutlines(const std::vector<const PositionRange*>& obstacles, const Position& tx, const Position& rx)
+{
+    std::vector<Position> rays;
+    std::vector<Position> intersections;
+    const double squaredLengthTxRx = squaredLength(tx, rx);
+
+    for (const PositionRange* outline : obstacles) {
+        PositionView view(*outline);
+        for (auto a = view.begin(), b = std::next(a); b != view.end(); ++a, ++b) {
+            PositionSegment segment(*a, *b);
+            Position rx_m = reflectPoint(rx, segment);
+            if (squaredLengthTxRx > squaredLength(tx, rx_m)) {
+                continue;
+            }
+
+            PositionSegment ray(tx, rx_m);
+            bg::intersection(segment, ray, intersections);
+            if (intersections.size() == 1) {
+                rays.push_back(intersections[0]);
+            }
+            intersections.clear();
+        }
+    }
+
+    return rays;
+}
+
+std::vector<Position> rectangle(double cx, double cy, double length, double width, double angle)
+{
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    std::vector<Position> outline;
+    for (const auto& corner : { std::make_pair(-0.5, -0.5), std::make_pair(0.5, -0.5), std::make_pair(0.5, 0.5), std::make_pair(-0.5, 0.5) }) {
+        const double x = corner.first * length;
+        const double y = corner.second * width;
+        outline.emplace_back(cx + c * x - s * y, cy + s * x + c * y);
+    }
+    bg::correct(outline);
+    return outline;
+}
+
+bool missesEllipseBox(const Wall& wall, const Position& a, const Position& b)
+{
+    // exact bounding box of ellipse with foci a and b
+    const double d = std::sqrt(squaredLength(a, b));
+    const double major = 0.5 * range;
+    const double minor = std::sqrt(std::max(0.0, major * major - 0.25 * d * d));
+    const double ux = d > 0.0 ? (b.x - a.x).value() / d : 1.0;
+    const double uy = d > 0.0 ? (b.y - a.y).value() / d : 0.0;
+    const double hx = std::hypot(major * ux, minor * uy);
+    const double hy = std::hypot(major * uy, minor * ux);
+    const double cx = 0.5 * (a.x + b.x).value();
+    const double cy = 0.5 * (a.y + b.y).value();
+    return std::max(wall.a.x.value(), wall.b.x.value()) < cx - hx || std::min(wall.a.x.value(), wall.b.x.value()) > cx + hx ||
+        std::max(wall.a.y.value(), wall.b.y.value()) < cy - hy || std::min(wall.a.y.value(), wall.b.y.value()) > cy + hy;
+}
+
+Result compare(unsigned seed, std::size_t links)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 2000.0);
+    std::uniform_real_distribution<double> angle(0.0, M_PI);
+    std::uniform_real_distribution<double> small(10.0, 60.0);
+    std::uniform_real_distribution<double> large(400.0, 1500.0);
+    std::uniform_real_distribution<double> width(15.0, 60.0);
+
+    std::vector<PositionRange> outlines;
+    for (unsigned i = 0; i < 400; ++i) {
+        outlines.push_back(rectangle(coordinate(rng), coordinate(rng), small(rng), small(rng), angle(rng)));
+    }
+    for (unsigned i = 0; i < 60; ++i) {
+        outlines.push_back(rectangle(coordinate(rng), coordinate(rng), large(rng), width(rng), angle(rng)));
+    }
+
+    // walls grouped by obstacle like in ObstacleIndex
+    std::vector<Wall> walls;
+    std::vector<std::size_t> offsets;
+    std::vector<Position> centroids;
+    for (std::size_t i = 0; i < outlines.size(); ++i) {
+        offsets.push_back(walls.size());
+        artery::gemv2::appendWalls(outlines[i], i, walls);
+        centroids.push_back(bg::return_centroid<Position>(outlines[i]));
+    }
+    offsets.push_back(walls.size());
+
+    Result result;
+    std::uniform_real_distribution<double> distance(1.0, 0.9 * range);
+    while (result.links < links) {
+        const Position tx { coordinate(rng), coordinate(rng) };
+        const double heading = 2.0 * angle(rng);
+        const double d = distance(rng);
+        const Position rx { tx.x.value() + d * std::cos(heading), tx.y.value() + d * std::sin(heading) };
+        ++result.links;
+
+        std::vector<std::size_t> selected;
+        std::vector<const PositionRange*> selectedOutlines;
+        for (std::size_t i = 0; i < outlines.size(); ++i) {
+            const Position& c = centroids[i];
+            if (bg::distance(tx, c) + bg::distance(rx, c) <= range) {
+                selected.push_back(i);
+                selectedOutlines.push_back(&outlines[i]);
+            }
+        }
+
+        std::vector<Position> rays;
+        Position reflection;
+        for (std::size_t obstacle : selected) {
+            for (std::size_t i = offsets[obstacle]; i < offsets[obstacle + 1]; ++i) {
+                if (artery::gemv2::reflectAtWall(walls[i], tx, rx, reflection)) {
+                    rays.push_back(reflection);
+                    if (missesEllipseBox(walls[i], tx, rx)) {
+                        ++result.beyondBox;
+                    }
+                }
+            }
+        }
+
+        const std::vector<Position> expected = scanOutlines(selectedOutlines, tx, rx);
+        result.reflections += expected.size();
+        if (rays.size() != expected.size()) {
+            ++result.mismatches;
+            std::cerr << "link " << result.links << ": " << rays.size() << " reflections at walls, "
+                << expected.size() << " by outline scan\n";
+            continue;
+        }
+        for (std::size_t i = 0; i < rays.size(); ++i) {
+            result.maxDeviation = std::max(result.maxDeviation, std::sqrt(squaredLength(rays[i], expected[i])));
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+int main()
+{
+    const Result result = compare(1, 20000);
+    std::cout << result.links << " links: " << result.reflections << " reflections, "
+        << result.beyondBox << " of them beyond the ellipse's bounding box, "
+        << result.mismatches << " mismatches, " << result.maxDeviation << " m maximum deviation\n";
+
+    const bool covered = result.beyondBox > 0;
+    if (!covered) {
+        std::cerr << "no reflections at walls of buildings straddling the ellipse\n";
+    }
+    return result.mismatches == 0 && result.maxDeviation < 1e-6 && covered ? 0 : 1;
+}
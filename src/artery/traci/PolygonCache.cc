@@ -0,0 +1,212 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/traci/PolygonCache.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace artery
+{
+
+namespace
+{
+
+const char cacheMagic[8] = { 'A', 'R', 'T', 'P', 'O', 'L', 'Y', '\0' };
+const std::uint32_t cacheVersion = 1;
+
+struct CacheHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t reserved;
+    std::uint64_t key;
+    std::uint64_t numPolygons;
+    std::uint64_t numPoints;
+    std::uint64_t numChars;
+};
+
+struct CacheRecord
+{
+    std::uint64_t pointOffset;
+    std::uint32_t numPoints;
+    std::uint32_t idOffset;
+    std::uint32_t idLength;
+    std::uint32_t typeOffset;
+    std::uint32_t typeLength;
+    std::uint8_t filled;
+    std::uint8_t valid;
+    std::uint8_t padding[2];
+};
+
+static_assert(sizeof(CacheHeader) == 48, "unexpected padding of cache header");
+static_assert(sizeof(CacheRecord) == 32, "unexpected padding of cache record");
+
+// file layout: header, records, points (x and y as double), characters of ids and types
+std::size_t expectedSize(const CacheHeader& header)
+{
+    return sizeof(CacheHeader) + header.numPolygons * sizeof(CacheRecord) +
+        header.numPoints * 2 * sizeof(double) + header.numChars;
+}
+
+} // namespace
+
+PolygonCacheKey::PolygonCacheKey() : mHash(UINT64_C(14695981039346656037))
+{
+    add(&cacheVersion, sizeof(cacheVersion));
+}
+
+void PolygonCacheKey::add(const void* data, std::size_t length)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < length; ++i) {
+        mHash ^= bytes[i];
+        mHash *= UINT64_C(1099511628211);
+    }
+}
+
+void PolygonCacheKey::add(const std::string& str)
+{
+    // include length so concatenations of different strings do not collide
+    const std::uint64_t length = str.size();
+    add(&length, sizeof(length));
+    add(str.data(), str.size());
+}
+
+void PolygonCacheKey::add(double value)
+{
+    add(&value, sizeof(value));
+}
+
+bool PolygonCacheKey::addFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    char buffer[4096];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        add(buffer, file.gcount());
+    }
+    return true;
+}
+
+bool readPolygonCache(const std::string& path, const PolygonCacheKey& key, std::vector<PolygonDatabase::Polygon>& polygons)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    const std::streamoff size = file.tellg();
+    file.seekg(0);
+
+    CacheHeader header;
+    if (size < std::streamoff(sizeof(header)) || !file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return false;
+    }
+    if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+        header.version != cacheVersion || header.key != key.value() || expectedSize(header) != std::uint64_t(size)) {
+        return false;
+    }
+
+    // each section is read at once, polygons are assembled from these buffers
+    std::vector<CacheRecord> records(header.numPolygons);
+    std::vector<double> points(header.numPoints * 2);
+    std::string chars(header.numChars, '\0');
+    if (!file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(CacheRecord)) ||
+        !file.read(reinterpret_cast<char*>(points.data()), points.size() * sizeof(double)) ||
+        !file.read(&chars[0], chars.size())) {
+        return false;
+    }
+
+    std::vector<PolygonDatabase::Polygon> result(records.size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        const CacheRecord& record = records[i];
+        if (record.pointOffset + record.numPoints > header.numPoints ||
+            std::uint64_t(record.idOffset) + record.idLength > header.numChars ||
+            std::uint64_t(record.typeOffset) + record.typeLength > header.numChars) {
+            return false;
+        }
+
+        PolygonDatabase::Polygon& polygon = result[i];
+        polygon.id.assign(chars, record.idOffset, record.idLength);
+        polygon.type.assign(chars, record.typeOffset, record.typeLength);
+        polygon.filled = record.filled != 0;
+        polygon.valid = record.valid != 0;
+        polygon.outline.reserve(record.numPoints);
+        const double* xy = points.data() + 2 * record.pointOffset;
+        for (std::size_t j = 0; j < record.numPoints; ++j, xy += 2) {
+            polygon.outline.emplace_back(xy[0], xy[1]);
+        }
+    }
+
+    polygons = std::move(result);
+    return true;
+}
+
+bool writePolygonCache(const std::string& path, const std::string& tmpSuffix, const PolygonCacheKey& key,
+        const std::vector<PolygonDatabase::Polygon>& polygons)
+{
+    CacheHeader header;
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version = cacheVersion;
+    header.reserved = 0;
+    header.key = key.value();
+    header.numPolygons = polygons.size();
+    header.numPoints = 0;
+    header.numChars = 0;
+
+    std::vector<CacheRecord> records;
+    records.reserve(polygons.size());
+    for (const PolygonDatabase::Polygon& polygon : polygons) {
+        CacheRecord record;
+        record.pointOffset = header.numPoints;
+        record.numPoints = polygon.outline.size();
+        record.idOffset = header.numChars;
+        record.idLength = polygon.id.size();
+        record.typeOffset = record.idOffset + record.idLength;
+        record.typeLength = polygon.type.size();
+        record.filled = polygon.filled ? 1 : 0;
+        record.valid = polygon.valid ? 1 : 0;
+        record.padding[0] = record.padding[1] = 0;
+        records.push_back(record);
+
+        header.numPoints += polygon.outline.size();
+        header.numChars += polygon.id.size() + polygon.type.size();
+    }
+
+    const std::string tmpPath = path + tmpSuffix;
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(CacheRecord));
+        for (const PolygonDatabase::Polygon& polygon : polygons) {
+            for (const Position& point : polygon.outline) {
+                const double xy[2] = { point.x.value(), point.y.value() };
+                file.write(reinterpret_cast<const char*>(xy), sizeof(xy));
+            }
+        }
+        for (const PolygonDatabase::Polygon& polygon : polygons) {
+            file.write(polygon.id.data(), polygon.id.size());
+            file.write(polygon.type.data(), polygon.type.size());
+        }
+
+        if (!file) {
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace artery
@@ -0,0 +1,70 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_POLYGONCACHE_H_7TQX2MWB
+#define ARTERY_POLYGONCACHE_H_7TQX2MWB
+
+#include "artery/traci/PolygonDatabase.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * PolygonCacheKey identifies the polygon source a cache file has been created from.
+ *
+ * It is a 64 bit FNV-1a hash over all fed values.
+ */
+class PolygonCacheKey
+{
+public:
+    PolygonCacheKey();
+
+    void add(const void* data, std::size_t length);
+    void add(const std::string&);
+    void add(double);
+
+    /**
+     * Add contents of a file
+     * \return false if file could not be read
+     */
+    bool addFile(const std::string& path);
+
+    std::uint64_t value() const { return mHash; }
+
+private:
+    std::uint64_t mHash;
+};
+
+/**
+ * Read polygons from a binary cache file
+ * \param path cache file
+ * \param key expected key of polygon source
+ * \param polygons destination, only modified on success
+ * \return true if cache file exists, is intact and matches the key
+ */
+bool readPolygonCache(const std::string& path, const PolygonCacheKey& key, std::vector<PolygonDatabase::Polygon>& polygons);
+
+/**
+ * Write polygons to a binary cache file
+ *
+ * The file is written to a temporary file first and renamed afterwards,
+ * i.e. concurrent simulation runs never see partially written cache files.
+ * \param path cache file
+ * \param tmpSuffix suffix of temporary file, unique among concurrent writers
+ * \param key key of polygon source
+ * \param polygons polygons to store
+ * \return true on success
+ */
+bool writePolygonCache(const std::string& path, const std::string& tmpSuffix, const PolygonCacheKey& key,
+        const std::vector<PolygonDatabase::Polygon>& polygons);
+
+} // namespace artery
+
+#endif /* ARTERY_POLYGONCACHE_H_7TQX2MWB */
@@ -0,0 +1,158 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/traci/PolygonDatabase.h"
+#include "artery/traci/Cast.h"
+#include "artery/traci/PolygonCache.h"
+#include "traci/API.h"
+#include <boost/algorithm/string.hpp>
+#include <boost/geometry.hpp>
+#include <omnetpp/cconfiguration.h>
+#include <algorithm>
+
+namespace artery
+{
+
+Define_Module(PolygonDatabase)
+
+using namespace omnetpp;
+namespace bg = boost::geometry;
+
+namespace
+{
+const simsignal_t traciCloseSignal = cComponent::registerSignal("traci.close");
+} // namespace
+
+void PolygonDatabase::initialize()
+{
+    cModule* traci = getModuleByPath(par("traciModule"));
+    if (traci) {
+        traci->subscribe(traciCloseSignal, this);
+    } else {
+        throw cRuntimeError("No TraCI module found for signal subscription");
+    }
+
+    mTypes.clear();
+    const std::string types = par("polygonTypes");
+    boost::split(mTypes, types, boost::is_any_of(" "));
+    mTypes.erase("");
+
+    mCacheFile = par("cacheFile").stdstringValue();
+    mCacheSources.clear();
+    const std::string sources = par("cacheSources");
+    boost::split(mCacheSources, sources, boost::is_any_of(" "));
+    mCacheSources.erase(std::remove(mCacheSources.begin(), mCacheSources.end(), ""), mCacheSources.end());
+
+    if (!mCacheFile.empty() && mCacheSources.empty()) {
+        // polygon IDs alone do not reveal changed shapes, a stale cache would be reused silently
+        EV_WARN << "polygon cache file " << mCacheFile << " is ignored because no cacheSources are given\n";
+        mCacheFile.clear();
+    }
+}
+
+void PolygonDatabase::finish()
+{
+    clear();
+}
+
+void PolygonDatabase::receiveSignal(cComponent* source, simsignal_t signal, const SimTime&, cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traciCloseSignal) {
+        clear();
+    }
+}
+
+void PolygonDatabase::load(const traci::API& traci)
+{
+    if (mLoaded) {
+        return;
+    }
+
+    const traci::Boundary boundary { traci.simulation.getNetBoundary() };
+    const std::vector<std::string> ids = traci.polygon.getIDList();
+
+    if (mCacheFile.empty()) {
+        fetchPolygons(traci, boundary, ids);
+    } else {
+        const PolygonCacheKey key = createCacheKey(boundary, ids);
+        if (readPolygonCache(mCacheFile, key, mPolygons)) {
+            EV_INFO << "polygons loaded from cache file " << mCacheFile << "\n";
+        } else {
+            EV_INFO << "cache file " << mCacheFile << " is missing or outdated, fetching polygons over TraCI\n";
+            fetchPolygons(traci, boundary, ids);
+            const std::string runId = getEnvir()->getConfigEx()->getVariable(CFGVAR_RUNID);
+            if (!writePolygonCache(mCacheFile, "." + runId + ".tmp", key, mPolygons)) {
+                EV_WARN << "writing polygon cache file " << mCacheFile << " failed\n";
+            }
+        }
+    }
+
+    EV_INFO << mPolygons.size() << " polygons loaded\n";
+    mLoaded = true;
+}
+
+void PolygonDatabase::fetchPolygons(const traci::API& traci, const traci::Boundary& boundary, const std::vector<std::string>& ids)
+{
+    const auto& polygons = traci.polygon;
+    std::string invalid;
+    for (const std::string& id : ids) {
+        Polygon polygon;
+        polygon.id = id;
+        polygon.type = polygons.getType(id);
+        if (!mTypes.empty() && mTypes.find(polygon.type) == mTypes.end()) {
+            EV_DEBUG << "ignore polygon " << id << " of type " << polygon.type << "\n";
+            continue;
+        }
+
+        polygon.filled = polygons.getFilled(id);
+        for (const traci::TraCIPosition& point : polygons.getShape(id).value) {
+            polygon.outline.push_back(traci::position_cast(boundary, point));
+        }
+
+        if (polygon.outline.empty()) {
+            EV_DEBUG << "ignore polygon " << id << " without shape\n";
+            continue;
+        }
+
+        bg::correct(polygon.outline); // fixes issues such as reversed point order
+        polygon.valid = bg::is_valid(polygon.outline, invalid);
+        if (!polygon.valid) {
+            EV_DEBUG << "polygon " << id << " is invalid (" << invalid << ")\n";
+        }
+
+        mPolygons.emplace_back(std::move(polygon));
+    }
+}
+
+PolygonCacheKey PolygonDatabase::createCacheKey(const traci::Boundary& boundary, const std::vector<std::string>& ids) const
+{
+    PolygonCacheKey key;
+    key.add(boundary.lowerLeftPosition().x);
+    key.add(boundary.lowerLeftPosition().y);
+    key.add(boundary.upperRightPosition().x);
+    key.add(boundary.upperRightPosition().y);
+    for (const std::string& type : mTypes) {
+        key.add(type);
+    }
+    for (const std::string& id : ids) {
+        key.add(id);
+    }
+    for (const std::string& source : mCacheSources) {
+        if (!key.addFile(source)) {
+            throw cRuntimeError("Cannot read polygon cache source %s", source.c_str());
+        }
+    }
+    return key;
+}
+
+void PolygonDatabase::clear()
+{
+    mPolygons.clear();
+    mLoaded = false;
+}
+
+} // namespace artery
@@ -0,0 +1,84 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_POLYGONDATABASE_H_D8NQ3XLC
+#define ARTERY_POLYGONDATABASE_H_D8NQ3XLC
+
+#include "artery/utility/Geometry.h"
+#include <omnetpp/clistener.h>
+#include <omnetpp/csimplemodule.h>
+#include <set>
+#include <string>
+#include <vector>
+
+// forward declaration
+namespace traci { class API; class Boundary; }
+
+namespace artery
+{
+
+class PolygonCacheKey;
+
+/**
+ * PolygonDatabase loads the static polygons (e.g. buildings and foliage) of a SUMO scenario once.
+ *
+ * Obstacle models such as the GlobalEnvironmentModel, GEMV2's obstacle indices and
+ * Veins' obstacle control pick their polygons from this database instead of querying
+ * each polygon over TraCI again. Shapes are corrected and validated only once here,
+ * but each consumer still builds its own spatial index of the polygons it selects.
+ *
+ * Polygons are loaded on demand by the first consumer, i.e. an unused database causes no TraCI traffic.
+ * Optionally, loaded polygons are stored in a binary cache file which is reused by later runs
+ * as long as the net boundary, the polygon IDs and the contents of the configured source files match.
+ * Caching is disabled without any source files because changed shapes would go unnoticed.
+ */
+class PolygonDatabase : public omnetpp::cSimpleModule, public omnetpp::cListener
+{
+public:
+    struct Polygon
+    {
+        std::string id;
+        std::string type;
+        bool filled = false;
+        bool valid = false; /*< outline passed boost::geometry::is_valid */
+        std::vector<Position> outline; /*< corrected by boost::geometry::correct */
+    };
+
+    // cSimpleModule
+    void initialize() override;
+    void finish() override;
+
+    // cListener
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, const omnetpp::SimTime&, omnetpp::cObject*) override;
+
+    /**
+     * Load polygons from cache file or TraCI unless they have been loaded already.
+     *
+     * Consumers call this method on TraCI initialization before accessing any polygons.
+     * \param api TraCI API
+     */
+    void load(const traci::API& api);
+
+    /**
+     * Get all loaded polygons (including invalid ones)
+     */
+    const std::vector<Polygon>& getPolygons() const { return mPolygons; }
+
+private:
+    void clear();
+    void fetchPolygons(const traci::API&, const traci::Boundary&, const std::vector<std::string>& ids);
+    PolygonCacheKey createCacheKey(const traci::Boundary&, const std::vector<std::string>& ids) const;
+
+    std::set<std::string> mTypes;
+    std::string mCacheFile;
+    std::vector<std::string> mCacheSources;
+    std::vector<Polygon> mPolygons;
+    bool mLoaded = false;
+};
+
+} // namespace artery
+
+#endif /* ARTERY_POLYGONDATABASE_H_D8NQ3XLC */
@@ -0,0 +1,110 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/utility/WorkerPool.h"
+#include <algorithm>
+
+namespace artery
+{
+
+WorkerPool::WorkerPool(unsigned threads) : mNext(0)
+{
+    if (threads == 0) {
+        threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    for (unsigned i = 1; i < threads; ++i) {
+        mWorkers.emplace_back(&WorkerPool::loop, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWakeup.notify_all();
+
+    for (std::thread& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(std::size_t count, const Job& job)
+{
+    if (mWorkers.empty() || count < 2) {
+        for (std::size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &job;
+        mCount = count;
+        mNext = 0;
+        mError = nullptr;
+        mPending = mWorkers.size();
+        ++mGeneration;
+    }
+    mWakeup.notify_all();
+
+    work();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this]() { return mPending == 0; });
+        mJob = nullptr;
+        std::swap(error, mError);
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void WorkerPool::loop()
+{
+    unsigned long generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeup.wait(lock, [this, generation]() { return mStop || mGeneration != generation; });
+            if (mStop) {
+                return;
+            }
+            generation = mGeneration;
+        }
+
+        work();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (--mPending == 0) {
+                mDone.notify_one();
+            }
+        }
+    }
+}
+
+void WorkerPool::work()
+{
+    for (std::size_t i = mNext++; i < mCount; i = mNext++) {
+        try {
+            (*mJob)(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mError) {
+                mError = std::current_exception();
+            }
+        }
+    }
+}
+
+} // namespace artery
@@ -0,0 +1,77 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_WORKERPOOL_H_KX3VN8TQ
+#define ARTERY_WORKERPOOL_H_KX3VN8TQ
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * WorkerPool executes independent jobs on a fixed set of threads.
+ *
+ * Jobs must not touch OMNeT++ state (context switches, signals, logging)
+ * because the simulation kernel is not thread-safe.
+ */
+class WorkerPool
+{
+public:
+    using Job = std::function<void(std::size_t)>;
+
+    /**
+     * \param threads total number of threads including the calling thread, 0 selects hardware concurrency
+     */
+    explicit WorkerPool(unsigned threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Run job for each index in [0, count) and block until all are done
+     *
+     * The calling thread takes part in processing. If any job throws,
+     * the first caught exception is rethrown after all jobs have finished.
+     * \param count number of job indices
+     * \param job callable invoked with each index exactly once
+     */
+    void run(std::size_t count, const Job& job);
+
+    /**
+     * Get number of threads processing jobs (including the calling thread)
+     */
+    unsigned size() const { return mWorkers.size() + 1; }
+
+private:
+    void loop();
+    void work();
+
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWakeup;
+    std::condition_variable mDone;
+    unsigned long mGeneration = 0;
+    unsigned mPending = 0;
+    bool mStop = false;
+
+    const Job* mJob = nullptr;
+    std::size_t mCount = 0;
+    std::atomic<std::size_t> mNext;
+    std::exception_ptr mError;
+};
+
+} // namespace artery
+
+#endif /* ARTERY_WORKERPOOL_H_KX3VN8TQ */
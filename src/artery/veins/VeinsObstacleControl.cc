@@ -1,5 +1,6 @@
 #include "artery/veins/VeinsObstacleControl.h"
 #include "artery/traci/Cast.h"
+#include "artery/traci/PolygonDatabase.h"
 #include "traci/API.h"
 #include "traci/Core.h"
 #include "traci/Position.h"
@@ -24,6 +25,16 @@ void VeinsObstacleControl::traciInit()
     auto core = dynamic_cast<traci::Core*>(getModuleByPath(traciCoreModule));
     if (!core) {
         throw omnetpp::cRuntimeError("No traci.Core module found at %s", traciCoreModule);
+    }
+
+    const std::string polygonDatabaseModule = par("polygonDatabaseModule").stdstringValue();
+    auto db = polygonDatabaseModule.empty() ? nullptr :
+        dynamic_cast<PolygonDatabase*>(getModuleByPath(polygonDatabaseModule.c_str()));
+    if (!polygonDatabaseModule.empty() && !db) {
+        throw omnetpp::cRuntimeError("No PolygonDatabase module found at %s", polygonDatabaseModule.c_str());
+    } else if (db) {
+        db->load(*core->getAPI());
+        fetchObstacles(*db);
     } else {
         fetchObstacles(core->getAPI());
     }
@@ -50,4 +61,20 @@ void VeinsObstacleControl::fetchObstacles(std::shared_ptr<traci::API> traci)
     EV_INFO << "Added " << fetched << " obstacles to " << this->getFullPath() << endl;
 }
 
+void VeinsObstacleControl::fetchObstacles(const PolygonDatabase& db)
+{
+    unsigned fetched = 0;
+    for (const PolygonDatabase::Polygon& polygon : db.getPolygons()) {
+        if (this->isTypeSupported(polygon.type)) {
+            std::vector<veins::Coord> shape;
+            for (const Position& point : polygon.outline) {
+                shape.push_back(veins::Coord { point.x.value(), point.y.value() });
+            }
+            this->addFromTypeAndShape(polygon.id, polygon.type, shape);
+            ++fetched;
+        }
+    }
+    EV_INFO << "Added " << fetched << " obstacles from polygon database to " << this->getFullPath() << endl;
+}
+
 } // namespace artery
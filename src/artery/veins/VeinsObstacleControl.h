@@ -9,6 +9,8 @@ namespace traci { class API; }
 namespace artery
 {
 
+class PolygonDatabase;
+
 class VeinsObstacleControl : public veins::ObstacleControl, public traci::Listener
 {
 public:
@@ -17,6 +19,7 @@ public:
 private:
     void traciInit() override;
     void fetchObstacles(std::shared_ptr<traci::API>);
+    void fetchObstacles(const PolygonDatabase&);
 };
 
 } // namespace artery
@@ -1,11 +1,52 @@
 #include "traci/API.h"
+#include "traci/GeoProjection.h"
 #include "traci/Launcher.h"
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
 #include <thread>
 
 namespace traci
 {
 
 TraCIGeoPosition API::convertGeo(const TraCIPosition& pos) const
+{
+    switch (m_geoProjectionMode) {
+        case GeoProjectionMode::Local:
+            return m_geoProjection->convertGeo(pos);
+        case GeoProjectionMode::Validate: {
+            TraCIGeoPosition geo = m_geoProjection->convertGeo(pos);
+            validateGeo(pos, geo);
+            return geo;
+        }
+        default:
+            return convertGeoRemote(pos);
+    }
+}
+
+TraCIPosition API::convert2D(const TraCIGeoPosition& pos) const
+{
+    if (m_geoProjectionMode == GeoProjectionMode::Local) {
+        return m_geoProjection->convert2D(pos);
+    } else {
+        return simulation.convertGeo(pos.longitude, pos.latitude, true);
+    }
+}
+
+void API::setGeoProjection(std::shared_ptr<const GeoProjection> projection, GeoProjectionMode mode, double tolerance)
+{
+    if (!projection && mode != GeoProjectionMode::TraCI) {
+        throw std::invalid_argument("local geo projection mode requires a projection");
+    }
+
+    m_geoProjection = std::move(projection);
+    m_geoProjectionMode = mode;
+    m_geoProjectionTolerance = tolerance;
+    m_geoProjectionDeviation = GeoProjectionDeviation {};
+}
+
+TraCIGeoPosition API::convertGeoRemote(const TraCIPosition& pos) const
 {
     libsumo::TraCIPosition result = simulation.convertGeo(pos.x, pos.y, false);
     TraCIGeoPosition geo;
@@ -14,9 +55,27 @@ TraCIGeoPosition API::convertGeo(const TraCIPosition& pos) const
     return geo;
 }
 
-TraCIPosition API::convert2D(const TraCIGeoPosition& pos) const
+void API::validateGeo(const TraCIPosition& pos, const TraCIGeoPosition& local) const
 {
-    return simulation.convertGeo(pos.longitude, pos.latitude, true);
+    static const double deg2rad = boost::math::double_constants::pi / 180.0;
+    static const double metresPerDegree = 111320.0;
+
+    const TraCIGeoPosition remote = convertGeoRemote(pos);
+    const double dy = (local.latitude - remote.latitude) * metresPerDegree;
+    const double dx = (local.longitude - remote.longitude) * metresPerDegree * std::cos(remote.latitude * deg2rad);
+    const double deviation = std::hypot(dx, dy);
+
+    ++m_geoProjectionDeviation.samples;
+    if (deviation > m_geoProjectionDeviation.maximum) {
+        m_geoProjectionDeviation.maximum = deviation;
+    }
+
+    if (deviation > m_geoProjectionTolerance) {
+        std::ostringstream msg;
+        msg << "local geo projection of (" << pos.x << ", " << pos.y << ") deviates by "
+            << deviation << " m from TraCI result";
+        throw std::runtime_error(msg.str());
+    }
 }
 
 void API::connect(const ServerEndpoint& endpoint)
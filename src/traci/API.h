@@ -8,10 +8,12 @@
 #include "traci/Position.h"
 #include "traci/Time.h"
 #include <omnetpp/simtime.h>
+#include <memory>
 
 namespace traci
 {
 
+class GeoProjection;
 class ServerEndpoint;
 
 class API : public TraCIAPI
@@ -19,10 +21,42 @@ class API : public TraCIAPI
 public:
     using Version = std::pair<int, std::string>;
 
+    enum class GeoProjectionMode
+    {
+        TraCI, /*< convert by simulation.convertGeo requests */
+        Local, /*< convert in-process by GeoProjection */
+        Validate /*< convert in-process and compare with TraCI result */
+    };
+
+    struct GeoProjectionDeviation
+    {
+        std::size_t samples = 0;
+        double maximum = 0.0; /*< maximum deviation in metres */
+    };
+
     TraCIGeoPosition convertGeo(const TraCIPosition&) const;
     TraCIPosition convert2D(const TraCIGeoPosition&) const;
 
+    /**
+     * Set projection used by convertGeo and convert2D
+     * \param projection local projection (required unless mode is TraCI)
+     * \param mode conversion mode
+     * \param tolerance maximum accepted deviation in metres (Validate mode only)
+     */
+    void setGeoProjection(std::shared_ptr<const GeoProjection>, GeoProjectionMode, double tolerance = 0.0);
+    GeoProjectionMode getGeoProjectionMode() const { return m_geoProjectionMode; }
+    const GeoProjectionDeviation& getGeoProjectionDeviation() const { return m_geoProjectionDeviation; }
+
     void connect(const ServerEndpoint&);
+
+private:
+    TraCIGeoPosition convertGeoRemote(const TraCIPosition&) const;
+    void validateGeo(const TraCIPosition&, const TraCIGeoPosition&) const;
+
+    std::shared_ptr<const GeoProjection> m_geoProjection;
+    GeoProjectionMode m_geoProjectionMode = GeoProjectionMode::TraCI;
+    double m_geoProjectionTolerance = 0.0;
+    mutable GeoProjectionDeviation m_geoProjectionDeviation;
 };
 
 } // namespace traci
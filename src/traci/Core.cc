@@ -1,9 +1,15 @@
 #include "traci/Core.h"
 #include "traci/Launcher.h"
 #include "traci/API.h"
+#include "traci/GeoProjection.h"
 #include "traci/SubscriptionManager.h"
 #include <inet/common/ModuleAccess.h>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+#include <omnetpp/cxmlelement.h>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 Define_Module(traci::Core)
 
@@ -44,6 +50,12 @@ void Core::initialize()
 
 void Core::finish()
 {
+    if (m_traci->getGeoProjectionMode() == API::GeoProjectionMode::Validate) {
+        const auto& deviation = m_traci->getGeoProjectionDeviation();
+        recordScalar("geoProjectionSamples", deviation.samples);
+        recordScalar("geoProjectionMaxDeviation", deviation.maximum, "m");
+    }
+
     emit(closeSignal, simTime());
     if (!m_connectEvent->isScheduled()) {
         m_traci->close();
@@ -66,6 +78,7 @@ void Core::handleMessage(cMessage* msg)
         m_traci->connect(m_launcher->launch());
         checkVersion();
         syncTime();
+        setupGeoProjection();
         emit(initSignal, simTime());
         m_updateInterval = Time { m_traci->simulation.getDeltaT() };
         scheduleAt(simTime() + m_updateInterval, m_updateEvent);
@@ -103,6 +116,58 @@ void Core::syncTime()
     }
 }
 
+void Core::setupGeoProjection()
+{
+    const std::string mode = par("geoProjection");
+    if (mode == "traci") {
+        m_traci->setGeoProjection(nullptr, API::GeoProjectionMode::TraCI);
+        return;
+    } else if (mode != "local" && mode != "validate") {
+        throw cRuntimeError("Unknown geo projection mode \"%s\"", mode.c_str());
+    }
+
+    cXMLElement* location = par("netLocation").xmlValue();
+    const char* projParameter = location ? location->getAttribute("projParameter") : nullptr;
+    const char* netOffset = location ? location->getAttribute("netOffset") : nullptr;
+    if (!projParameter || !netOffset) {
+        throw cRuntimeError("Geo projection mode \"%s\" requires netLocation with projParameter and netOffset", mode.c_str());
+    }
+
+    std::vector<std::string> offset;
+    boost::algorithm::split(offset, netOffset, boost::algorithm::is_any_of(","));
+    if (offset.size() != 2) {
+        throw cRuntimeError("Malformed netOffset \"%s\"", netOffset);
+    }
+    TraCIPosition origin;
+    try {
+        origin.x = std::stod(offset[0]);
+        origin.y = std::stod(offset[1]);
+        origin.z = 0.0;
+    } catch (const std::logic_error&) {
+        throw cRuntimeError("Malformed netOffset \"%s\"", netOffset);
+    }
+
+    if (!GeoProjection::isSupported(projParameter)) {
+        EV_WARN << "Projection \"" << projParameter << "\" is not supported locally, falling back to TraCI" << endl;
+        m_traci->setGeoProjection(nullptr, API::GeoProjectionMode::TraCI);
+        return;
+    }
+
+    std::shared_ptr<GeoProjection> projection;
+    try {
+        projection = std::make_shared<GeoProjection>(projParameter, origin);
+    } catch (const std::logic_error& e) {
+        throw cRuntimeError("Invalid projParameter \"%s\": %s", projParameter, e.what());
+    }
+    if (mode == "local") {
+        m_traci->setGeoProjection(projection, API::GeoProjectionMode::Local);
+        EV_INFO << "Converting geo positions locally using \"" << projParameter << "\"" << endl;
+    } else {
+        m_traci->setGeoProjection(projection, API::GeoProjectionMode::Validate, par("geoProjectionTolerance"));
+        EV_INFO << "Validating local geo projection \"" << projParameter << "\" against TraCI" << endl;
+    }
+}
+
 std::shared_ptr<API> Core::getAPI()
 {
     return m_traci;
@@ -28,6 +28,7 @@ public:
 protected:
     virtual void checkVersion();
     virtual void syncTime();
+    virtual void setupGeoProjection();
 
 private:
     omnetpp::cMessage* m_connectEvent;
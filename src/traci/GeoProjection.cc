@@ -0,0 +1,258 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/GeoProjection.h"
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace traci
+{
+
+namespace
+{
+
+const double pi = boost::math::double_constants::pi;
+const double deg2rad = pi / 180.0;
+const double rad2deg = 180.0 / pi;
+
+using ProjParameters = std::map<std::string, std::string>;
+
+ProjParameters parseProjString(const std::string& proj)
+{
+    ProjParameters params;
+    std::vector<std::string> tokens;
+    boost::algorithm::split(tokens, proj, boost::algorithm::is_space(), boost::algorithm::token_compress_on);
+    for (const std::string& token : tokens) {
+        if (token.size() < 2 || token.front() != '+') {
+            continue;
+        }
+        auto equal = token.find('=');
+        if (equal == std::string::npos) {
+            params[token.substr(1)] = "";
+        } else {
+            params[token.substr(1, equal - 1)] = token.substr(equal + 1);
+        }
+    }
+    return params;
+}
+
+double parseNumber(const std::string& key, const std::string& value)
+{
+    try {
+        std::size_t parsed = 0;
+        const double number = std::stod(value, &parsed);
+        if (parsed == value.size()) {
+            return number;
+        }
+    } catch (const std::logic_error&) {
+    }
+    throw std::invalid_argument("malformed projection parameter +" + key + "=" + value);
+}
+
+double getParameter(const ProjParameters& params, const std::string& key, double fallback)
+{
+    auto found = params.find(key);
+    return found != params.end() ? parseNumber(found->first, found->second) : fallback;
+}
+
+/**
+ * Get flattening of (supported) ellipsoid
+ * \return flattening or NaN if unknown
+ */
+double getFlattening(const ProjParameters& params)
+{
+    auto ellps = params.find("ellps");
+    auto datum = params.find("datum");
+    const std::string name = ellps != params.end() ? ellps->second :
+        datum != params.end() ? datum->second : "WGS84";
+
+    if (name == "WGS84") {
+        return 1.0 / 298.257223563;
+    } else if (name == "GRS80") {
+        return 1.0 / 298.257222101;
+    } else {
+        return std::nan("");
+    }
+}
+
+} // namespace
+
+bool GeoProjection::isSupported(const std::string& proj)
+{
+    if (proj == "!" || proj == "-") {
+        return true;
+    }
+
+    const ProjParameters params = parseProjString(proj);
+    auto method = params.find("proj");
+    if (method == params.end() || (method->second != "utm" && method->second != "tmerc")) {
+        return false;
+    }
+
+    auto units = params.find("units");
+    if (units != params.end() && units->second != "m") {
+        return false;
+    }
+
+    return !std::isnan(getFlattening(params));
+}
+
+GeoProjection::GeoProjection(const std::string& proj, const TraCIPosition& offset) :
+    m_method(Method::None), m_offset(offset)
+{
+    if (!isSupported(proj)) {
+        throw std::invalid_argument("unsupported projection: " + proj);
+    }
+
+    if (proj == "!") {
+        m_method = Method::None;
+    } else if (proj == "-") {
+        m_method = Method::Simple;
+    } else {
+        m_method = Method::TransverseMercator;
+        parseTransverseMercator(proj);
+    }
+}
+
+void GeoProjection::parseTransverseMercator(const std::string& proj)
+{
+    const ProjParameters params = parseProjString(proj);
+    const double a = 6378137.0;
+    const double f = getFlattening(params);
+    const double n = f / (2.0 - f);
+    const double n2 = n * n;
+    const double n3 = n2 * n;
+    const double n4 = n3 * n;
+
+    m_rectifyingRadius = a / (1.0 + n) * (1.0 + n2 / 4.0 + n4 / 64.0);
+    m_eccentricity = 2.0 * std::sqrt(n) / (1.0 + n);
+    m_alpha = {{
+        n / 2.0 - 2.0 / 3.0 * n2 + 5.0 / 16.0 * n3 + 41.0 / 180.0 * n4,
+        13.0 / 48.0 * n2 - 3.0 / 5.0 * n3 + 557.0 / 1440.0 * n4,
+        61.0 / 240.0 * n3 - 103.0 / 140.0 * n4,
+        49561.0 / 161280.0 * n4
+    }};
+    m_beta = {{
+        n / 2.0 - 2.0 / 3.0 * n2 + 37.0 / 96.0 * n3 - 1.0 / 360.0 * n4,
+        1.0 / 48.0 * n2 + 1.0 / 15.0 * n3 - 437.0 / 1440.0 * n4,
+        17.0 / 480.0 * n3 - 37.0 / 840.0 * n4,
+        4397.0 / 161280.0 * n4
+    }};
+    m_delta = {{
+        2.0 * n - 2.0 / 3.0 * n2 - 2.0 * n3 + 116.0 / 45.0 * n4,
+        7.0 / 3.0 * n2 - 8.0 / 5.0 * n3 - 227.0 / 45.0 * n4,
+        56.0 / 15.0 * n3 - 136.0 / 35.0 * n4,
+        4279.0 / 630.0 * n4
+    }};
+
+    if (params.at("proj") == "utm") {
+        auto zone = params.find("zone");
+        if (zone == params.end()) {
+            throw std::invalid_argument("UTM projection lacks zone: " + proj);
+        }
+        m_lon0 = (parseNumber(zone->first, zone->second) * 6.0 - 183.0) * deg2rad;
+        m_k0 = 0.9996;
+        m_falseEasting = 500000.0;
+        m_falseNorthing = params.count("south") ? 10000000.0 : 0.0;
+        m_xi0 = 0.0;
+    } else {
+        m_lon0 = getParameter(params, "lon_0", 0.0) * deg2rad;
+        m_k0 = getParameter(params, "k_0", getParameter(params, "k", 1.0));
+        m_falseEasting = getParameter(params, "x_0", 0.0);
+        m_falseNorthing = getParameter(params, "y_0", 0.0);
+        m_xi0 = conformalNorthing(getParameter(params, "lat_0", 0.0) * deg2rad);
+    }
+}
+
+double GeoProjection::conformalNorthing(double phi) const
+{
+    // northing on central meridian (eta = 0) in units of rectifying radius
+    const double e = m_eccentricity;
+    const double xi_ = std::atan(std::sinh(std::atanh(std::sin(phi)) - e * std::atanh(e * std::sin(phi))));
+    double xi = xi_;
+    for (unsigned j = 1; j <= m_alpha.size(); ++j) {
+        xi += m_alpha[j - 1] * std::sin(2.0 * j * xi_);
+    }
+    return xi;
+}
+
+TraCIGeoPosition GeoProjection::convertGeo(const TraCIPosition& pos) const
+{
+    const double x = pos.x - m_offset.x;
+    const double y = pos.y - m_offset.y;
+    TraCIGeoPosition geo;
+
+    if (m_method == Method::None) {
+        geo.longitude = x;
+        geo.latitude = y;
+    } else if (m_method == Method::Simple) {
+        geo.latitude = y / 111136.0;
+        geo.longitude = x / 111320.0 / std::cos(geo.latitude * deg2rad);
+    } else {
+        const double xi = (y - m_falseNorthing) / (m_k0 * m_rectifyingRadius) + m_xi0;
+        const double eta = (x - m_falseEasting) / (m_k0 * m_rectifyingRadius);
+
+        double xi_ = xi;
+        double eta_ = eta;
+        for (unsigned j = 1; j <= m_beta.size(); ++j) {
+            xi_ -= m_beta[j - 1] * std::sin(2.0 * j * xi) * std::cosh(2.0 * j * eta);
+            eta_ -= m_beta[j - 1] * std::cos(2.0 * j * xi) * std::sinh(2.0 * j * eta);
+        }
+
+        const double chi = std::asin(std::sin(xi_) / std::cosh(eta_));
+        double phi = chi;
+        for (unsigned j = 1; j <= m_delta.size(); ++j) {
+            phi += m_delta[j - 1] * std::sin(2.0 * j * chi);
+        }
+
+        geo.latitude = phi * rad2deg;
+        geo.longitude = (m_lon0 + std::atan2(std::sinh(eta_), std::cos(xi_))) * rad2deg;
+    }
+
+    return geo;
+}
+
+TraCIPosition GeoProjection::convert2D(const TraCIGeoPosition& geo) const
+{
+    TraCIPosition pos;
+
+    if (m_method == Method::None) {
+        pos.x = geo.longitude;
+        pos.y = geo.latitude;
+    } else if (m_method == Method::Simple) {
+        pos.x = geo.longitude * 111320.0 * std::cos(geo.latitude * deg2rad);
+        pos.y = geo.latitude * 111136.0;
+    } else {
+        const double e = m_eccentricity;
+        const double phi = geo.latitude * deg2rad;
+        const double dlambda = geo.longitude * deg2rad - m_lon0;
+        const double t = std::sinh(std::atanh(std::sin(phi)) - e * std::atanh(e * std::sin(phi)));
+        const double xi_ = std::atan2(t, std::cos(dlambda));
+        const double eta_ = std::atanh(std::sin(dlambda) / std::sqrt(1.0 + t * t));
+
+        double xi = xi_;
+        double eta = eta_;
+        for (unsigned j = 1; j <= m_alpha.size(); ++j) {
+            xi += m_alpha[j - 1] * std::sin(2.0 * j * xi_) * std::cosh(2.0 * j * eta_);
+            eta += m_alpha[j - 1] * std::cos(2.0 * j * xi_) * std::sinh(2.0 * j * eta_);
+        }
+
+        pos.x = m_falseEasting + m_k0 * m_rectifyingRadius * eta;
+        pos.y = m_falseNorthing + m_k0 * m_rectifyingRadius * (xi - m_xi0);
+    }
+
+    pos.x += m_offset.x;
+    pos.y += m_offset.y;
+    pos.z = 0.0;
+    return pos;
+}
+
+} // namespace traci
@@ -0,0 +1,72 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Raphael Riebl et al.
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef GEOPROJECTION_H_QJ7RM2XW
+#define GEOPROJECTION_H_QJ7RM2XW
+
+#include "traci/GeoPosition.h"
+#include "traci/Position.h"
+#include <array>
+#include <string>
+
+namespace traci
+{
+
+/**
+ * GeoProjection converts between SUMO network coordinates and WGS84 in-process.
+ *
+ * It mirrors SUMO's GeoConvHelper for the projections found in the wild:
+ * - "!" (no projection, geo position equals offset-corrected network position)
+ * - "-" (SUMO's simple projection)
+ * - "+proj=utm" and "+proj=tmerc" on WGS84/GRS80 ellipsoids
+ *
+ * Transverse Mercator is evaluated by Krüger series (4th order), which is accurate
+ * to well below a millimetre inside a UTM zone.
+ */
+class GeoProjection
+{
+public:
+    /**
+     * Create projection from attributes of a SUMO network's location element
+     * \param projParameter value of "projParameter" attribute
+     * \param netOffset value of "netOffset" attribute
+     * \throw std::invalid_argument if projection is not supported
+     */
+    GeoProjection(const std::string& projParameter, const TraCIPosition& netOffset);
+
+    TraCIGeoPosition convertGeo(const TraCIPosition&) const;
+    TraCIPosition convert2D(const TraCIGeoPosition&) const;
+
+    /**
+     * Check if a projection string can be handled by GeoProjection
+     */
+    static bool isSupported(const std::string& projParameter);
+
+private:
+    enum class Method { None, Simple, TransverseMercator };
+
+    void parseTransverseMercator(const std::string& projParameter);
+    double conformalNorthing(double latitude) const;
+
+    Method m_method;
+    TraCIPosition m_offset;
+
+    // transverse Mercator parameters
+    double m_lon0;
+    double m_k0;
+    double m_falseEasting;
+    double m_falseNorthing;
+    double m_xi0;
+    double m_rectifyingRadius;
+    double m_eccentricity;
+    std::array<double, 4> m_alpha;
+    std::array<double, 4> m_beta;
+    std::array<double, 4> m_delta;
+};
+
+} // namespace traci
+
+#endif /* GEOPROJECTION_H_QJ7RM2XW */